@@ -0,0 +1,729 @@
+//! A stable C ABI for embedding `temporal_rs` in C and C++ applications.
+//!
+//! The C ABI only exposes ISO calendar values as flat `#[repr(C)]` structs. Every entry point
+//! returns a [`TemporalStatus`] and writes its result to a caller provided output buffer, so
+//! values never need to be marshalled into or out of Rust owned allocations.
+//!
+//! The matching C header lives in `temporal_capi/include/temporal_rs.h`.
+
+use core::{slice, str::FromStr};
+
+use num_traits::ToPrimitive;
+
+use crate::{
+    components::{
+        duration::{DateDuration, TimeDuration},
+        Duration, Instant,
+    },
+    error::ErrorKind,
+    iso::{IsoDate, IsoDateTime, IsoTime},
+    options::{ArithmeticOverflow, TemporalUnit},
+    TemporalError, TemporalResult, NS_MAX_INSTANT, NS_MIN_INSTANT,
+};
+
+// ==== C ABI types ====
+
+/// The status code returned by every C ABI entry point.
+#[repr(i32)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum TemporalStatus {
+    /// The operation completed successfully.
+    Ok = 0,
+    /// A generic error.
+    GenericError = 1,
+    /// A `TypeError`.
+    TypeError = 2,
+    /// A `RangeError`.
+    RangeError = 3,
+    /// A `SyntaxError`.
+    SyntaxError = 4,
+    /// An internal assertion failed.
+    AssertError = 5,
+    /// A required pointer argument was null.
+    NullPointer = 6,
+}
+
+impl From<TemporalError> for TemporalStatus {
+    fn from(value: TemporalError) -> Self {
+        match value.kind() {
+            ErrorKind::Generic => Self::GenericError,
+            ErrorKind::Type => Self::TypeError,
+            ErrorKind::Range => Self::RangeError,
+            ErrorKind::Syntax => Self::SyntaxError,
+            ErrorKind::Assert => Self::AssertError,
+        }
+    }
+}
+
+/// An ISO calendar date.
+#[repr(C)]
+#[derive(Debug, Default, Clone, Copy, PartialEq, Eq)]
+pub struct TemporalIsoDate {
+    /// The ISO year.
+    pub year: i32,
+    /// The ISO month, from 1 to 12.
+    pub month: u8,
+    /// The ISO day, from 1 to 31.
+    pub day: u8,
+}
+
+/// A wall-clock time.
+#[repr(C)]
+#[derive(Debug, Default, Clone, Copy, PartialEq, Eq)]
+pub struct TemporalIsoTime {
+    /// The hour, from 0 to 23.
+    pub hour: u8,
+    /// The minute, from 0 to 59.
+    pub minute: u8,
+    /// The second, from 0 to 59.
+    pub second: u8,
+    /// The millisecond, from 0 to 999.
+    pub millisecond: u16,
+    /// The microsecond, from 0 to 999.
+    pub microsecond: u16,
+    /// The nanosecond, from 0 to 999.
+    pub nanosecond: u16,
+}
+
+/// An ISO calendar date and wall-clock time.
+#[repr(C)]
+#[derive(Debug, Default, Clone, Copy, PartialEq, Eq)]
+pub struct TemporalIsoDateTime {
+    /// The date component.
+    pub date: TemporalIsoDate,
+    /// The time component.
+    pub time: TemporalIsoTime,
+}
+
+/// An exact instant represented as nanoseconds since the epoch.
+///
+/// The 128-bit nanosecond value is split into a signed high half and an unsigned low half.
+#[repr(C)]
+#[derive(Debug, Default, Clone, Copy, PartialEq, Eq)]
+pub struct TemporalInstant {
+    /// The upper 64 bits of the epoch nanoseconds.
+    pub epoch_nanoseconds_high: i64,
+    /// The lower 64 bits of the epoch nanoseconds.
+    pub epoch_nanoseconds_low: u64,
+}
+
+/// A duration record.
+#[repr(C)]
+#[derive(Debug, Default, Clone, Copy, PartialEq)]
+pub struct TemporalDuration {
+    /// The years field.
+    pub years: f64,
+    /// The months field.
+    pub months: f64,
+    /// The weeks field.
+    pub weeks: f64,
+    /// The days field.
+    pub days: f64,
+    /// The hours field.
+    pub hours: f64,
+    /// The minutes field.
+    pub minutes: f64,
+    /// The seconds field.
+    pub seconds: f64,
+    /// The milliseconds field.
+    pub milliseconds: f64,
+    /// The microseconds field.
+    pub microseconds: f64,
+    /// The nanoseconds field.
+    pub nanoseconds: f64,
+}
+
+/// A borrowed UTF-8 string.
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct TemporalUtf8 {
+    /// A pointer to the first byte of the string.
+    pub data: *const u8,
+    /// The length of the string in bytes.
+    pub len: usize,
+}
+
+/// `ArithmeticOverflow::Constrain` as a C ABI value.
+pub const TEMPORAL_OVERFLOW_CONSTRAIN: i32 = 0;
+/// `ArithmeticOverflow::Reject` as a C ABI value.
+pub const TEMPORAL_OVERFLOW_REJECT: i32 = 1;
+
+// ==== Conversions ====
+
+impl TemporalIsoDate {
+    fn to_iso(self, overflow: ArithmeticOverflow) -> TemporalResult<IsoDate> {
+        IsoDate::new(self.year, self.month.into(), self.day.into(), overflow)
+    }
+}
+
+impl From<IsoDate> for TemporalIsoDate {
+    fn from(value: IsoDate) -> Self {
+        Self {
+            year: value.year,
+            month: value.month,
+            day: value.day,
+        }
+    }
+}
+
+impl TemporalIsoTime {
+    fn to_iso(self) -> TemporalResult<IsoTime> {
+        IsoTime::new(
+            self.hour.into(),
+            self.minute.into(),
+            self.second.into(),
+            self.millisecond.into(),
+            self.microsecond.into(),
+            self.nanosecond.into(),
+            ArithmeticOverflow::Reject,
+        )
+    }
+}
+
+impl TemporalInstant {
+    /// Creates a `TemporalInstant` from epoch nanoseconds.
+    #[must_use]
+    pub const fn from_epoch_nanoseconds(nanos: i128) -> Self {
+        Self {
+            epoch_nanoseconds_high: (nanos >> 64) as i64,
+            epoch_nanoseconds_low: nanos as u64,
+        }
+    }
+
+    /// Returns the epoch nanoseconds of this `TemporalInstant`.
+    #[must_use]
+    pub const fn epoch_nanoseconds(self) -> i128 {
+        ((self.epoch_nanoseconds_high as i128) << 64) | self.epoch_nanoseconds_low as i128
+    }
+}
+
+impl TemporalDuration {
+    fn to_duration(self) -> TemporalResult<Duration> {
+        Duration::new(
+            self.years,
+            self.months,
+            self.weeks,
+            self.days,
+            self.hours,
+            self.minutes,
+            self.seconds,
+            self.milliseconds,
+            self.microseconds,
+            self.nanoseconds,
+        )
+    }
+}
+
+impl From<&Duration> for TemporalDuration {
+    fn from(value: &Duration) -> Self {
+        Self {
+            years: value.years(),
+            months: value.months(),
+            weeks: value.weeks(),
+            days: value.days(),
+            hours: value.hours(),
+            minutes: value.minutes(),
+            seconds: value.seconds(),
+            milliseconds: value.milliseconds(),
+            microseconds: value.microseconds(),
+            nanoseconds: value.nanoseconds(),
+        }
+    }
+}
+
+fn overflow_from_abi(overflow: i32) -> TemporalResult<ArithmeticOverflow> {
+    match overflow {
+        TEMPORAL_OVERFLOW_CONSTRAIN => Ok(ArithmeticOverflow::Constrain),
+        TEMPORAL_OVERFLOW_REJECT => Ok(ArithmeticOverflow::Reject),
+        _ => Err(TemporalError::range().with_message("Invalid overflow option.")),
+    }
+}
+
+fn unit_from_abi(unit: i32) -> TemporalResult<TemporalUnit> {
+    match usize::try_from(unit) {
+        Ok(unit @ 1..=10) => Ok(TemporalUnit::from(unit)),
+        _ => Err(TemporalError::range().with_message("Invalid TemporalUnit.")),
+    }
+}
+
+/// # Safety
+///
+/// `value.data` must be null or valid for `value.len` byte reads.
+unsafe fn str_from_abi<'a>(value: TemporalUtf8) -> Result<&'a str, TemporalStatus> {
+    if value.data.is_null() {
+        return Err(TemporalStatus::NullPointer);
+    }
+    // SAFETY: The caller guarantees that `data` is valid for `len` bytes.
+    let bytes = unsafe { slice::from_raw_parts(value.data, value.len) };
+    core::str::from_utf8(bytes).map_err(|_| TemporalStatus::SyntaxError)
+}
+
+/// Converts the result of an entry point into a status, writing a successful value to `out`.
+///
+/// # Safety
+///
+/// `out` must be null or valid for writes.
+unsafe fn write_result<T>(result: Result<T, TemporalStatus>, out: *mut T) -> TemporalStatus {
+    if out.is_null() {
+        return TemporalStatus::NullPointer;
+    }
+    match result {
+        Ok(value) => {
+            // SAFETY: `out` is non-null and the caller guarantees it is valid for writes.
+            unsafe { out.write(value) };
+            TemporalStatus::Ok
+        }
+        Err(status) => status,
+    }
+}
+
+/// # Safety
+///
+/// `value` must be null or valid for reads.
+unsafe fn read_arg<T: Copy>(value: *const T) -> Result<T, TemporalStatus> {
+    // SAFETY: The caller guarantees that a non-null `value` is valid for reads.
+    unsafe { value.as_ref() }
+        .copied()
+        .ok_or(TemporalStatus::NullPointer)
+}
+
+/// Runs `op` over `len` inputs, writing each result to the matching output slot.
+///
+/// Returns the first non-`Ok` status encountered; outputs after the failing index are left unwritten.
+///
+/// # Safety
+///
+/// `input` must be valid for `len` reads and `out` must be valid for `len` writes.
+unsafe fn run_batch<I: Copy, O>(
+    input: *const I,
+    len: usize,
+    out: *mut O,
+    mut op: impl FnMut(I) -> Result<O, TemporalStatus>,
+) -> TemporalStatus {
+    if len == 0 {
+        return TemporalStatus::Ok;
+    }
+    if input.is_null() || out.is_null() {
+        return TemporalStatus::NullPointer;
+    }
+    // SAFETY: The caller guarantees `input` and `out` are valid for `len` elements.
+    let (input, out) = unsafe {
+        (
+            slice::from_raw_parts(input, len),
+            slice::from_raw_parts_mut(out, len),
+        )
+    };
+    for (value, slot) in input.iter().zip(out.iter_mut()) {
+        match op(*value) {
+            Ok(result) => *slot = result,
+            Err(status) => return status,
+        }
+    }
+    TemporalStatus::Ok
+}
+
+// ==== Operations ====
+
+fn iso_date_add(
+    date: TemporalIsoDate,
+    duration: &Duration,
+    overflow: ArithmeticOverflow,
+) -> TemporalResult<TemporalIsoDate> {
+    let date = date.to_iso(ArithmeticOverflow::Reject)?;
+    let (balance_days, _) =
+        TimeDuration::from_normalized(duration.time().to_normalized(), TemporalUnit::Day)?;
+    let result = date.add_date_duration(
+        &DateDuration::new_unchecked(
+            duration.years(),
+            duration.months(),
+            duration.weeks(),
+            duration.days() + balance_days,
+        ),
+        overflow,
+    )?;
+    // Validate that the balanced result is within the ISO date time limits.
+    TemporalIsoDate::from(result)
+        .to_iso(ArithmeticOverflow::Reject)
+        .map(Into::into)
+}
+
+fn iso_date_time_to_instant(
+    date_time: TemporalIsoDateTime,
+    offset_nanoseconds: i64,
+) -> TemporalResult<TemporalInstant> {
+    let date_time = IsoDateTime::new(
+        date_time.date.to_iso(ArithmeticOverflow::Reject)?,
+        date_time.time.to_iso()?,
+    )?;
+    let nanos = date_time.as_nanoseconds() - i128::from(offset_nanoseconds);
+    if !(NS_MIN_INSTANT..=NS_MAX_INSTANT).contains(&nanos) {
+        return Err(TemporalError::range()
+            .with_message("Instant nanoseconds are not within a valid epoch range."));
+    }
+    Ok(TemporalInstant::from_epoch_nanoseconds(nanos))
+}
+
+fn instant_from_str(source: &str) -> TemporalResult<TemporalInstant> {
+    let instant = Instant::from_str(source)?;
+    let nanos = instant.nanos.to_i128().ok_or(TemporalError::assert())?;
+    Ok(TemporalInstant::from_epoch_nanoseconds(nanos))
+}
+
+// ==== Entry points ====
+
+/// Validates an ISO date.
+///
+/// # Safety
+///
+/// `date` must be null or valid for reads.
+#[no_mangle]
+pub unsafe extern "C" fn temporal_iso_date_validate(
+    date: *const TemporalIsoDate,
+) -> TemporalStatus {
+    // SAFETY: Upheld by the caller.
+    match unsafe { read_arg(date) } {
+        Ok(date) => match date.to_iso(ArithmeticOverflow::Reject) {
+            Ok(_) => TemporalStatus::Ok,
+            Err(e) => e.into(),
+        },
+        Err(status) => status,
+    }
+}
+
+/// Adds `duration` to `date`, writing the resulting date to `out`.
+///
+/// # Safety
+///
+/// `date` and `duration` must be null or valid for reads, and `out` must be null or valid for writes.
+#[no_mangle]
+pub unsafe extern "C" fn temporal_iso_date_add(
+    date: *const TemporalIsoDate,
+    duration: *const TemporalDuration,
+    overflow: i32,
+    out: *mut TemporalIsoDate,
+) -> TemporalStatus {
+    // SAFETY: Upheld by the caller.
+    let result = unsafe { read_arg(date).and_then(|date| Ok((date, read_arg(duration)?))) }
+        .and_then(|(date, duration)| {
+            let duration = duration.to_duration()?;
+            Ok(iso_date_add(date, &duration, overflow_from_abi(overflow)?)?)
+        });
+    // SAFETY: Upheld by the caller.
+    unsafe { write_result(result, out) }
+}
+
+/// Adds `duration` to each of the `len` dates, writing the resulting dates to `out`.
+///
+/// On error, the status of the first failing date is returned and later outputs are left unwritten.
+///
+/// # Safety
+///
+/// `dates` must be valid for `len` reads, `duration` must be null or valid for reads, and `out`
+/// must be valid for `len` writes.
+#[no_mangle]
+pub unsafe extern "C" fn temporal_iso_date_add_batch(
+    dates: *const TemporalIsoDate,
+    len: usize,
+    duration: *const TemporalDuration,
+    overflow: i32,
+    out: *mut TemporalIsoDate,
+) -> TemporalStatus {
+    // SAFETY: Upheld by the caller.
+    let prepared = unsafe { read_arg(duration) }
+        .and_then(|duration| Ok((duration.to_duration()?, overflow_from_abi(overflow)?)));
+    let (duration, overflow) = match prepared {
+        Ok(prepared) => prepared,
+        Err(status) => return status,
+    };
+    // SAFETY: Upheld by the caller.
+    unsafe {
+        run_batch(dates, len, out, |date| {
+            Ok(iso_date_add(date, &duration, overflow)?)
+        })
+    }
+}
+
+/// Computes the duration from `one` until `two` balanced up to `largest_unit`, writing it to `out`.
+///
+/// `largest_unit` is one of 7 (day), 8 (week), 9 (month), or 10 (year).
+///
+/// # Safety
+///
+/// `one` and `two` must be null or valid for reads, and `out` must be null or valid for writes.
+#[no_mangle]
+pub unsafe extern "C" fn temporal_iso_date_until(
+    one: *const TemporalIsoDate,
+    two: *const TemporalIsoDate,
+    largest_unit: i32,
+    out: *mut TemporalDuration,
+) -> TemporalStatus {
+    // SAFETY: Upheld by the caller.
+    let result = unsafe { read_arg(one).and_then(|one| Ok((one, read_arg(two)?))) }.and_then(
+        |(one, two)| {
+            let largest_unit = unit_from_abi(largest_unit)?;
+            if largest_unit < TemporalUnit::Day {
+                return Err(TemporalError::range()
+                    .with_message("largestUnit must be a date unit.")
+                    .into());
+            }
+            let one = one.to_iso(ArithmeticOverflow::Reject)?;
+            let two = two.to_iso(ArithmeticOverflow::Reject)?;
+            let date_duration = one.diff_iso_date(&two, largest_unit)?;
+            Ok(TemporalDuration::from(&Duration::from_date_duration(
+                &date_duration,
+            )))
+        },
+    );
+    // SAFETY: Upheld by the caller.
+    unsafe { write_result(result, out) }
+}
+
+/// Converts a date-time at the provided UTC offset to an exact instant, writing it to `out`.
+///
+/// # Safety
+///
+/// `date_time` must be null or valid for reads, and `out` must be null or valid for writes.
+#[no_mangle]
+pub unsafe extern "C" fn temporal_iso_date_time_to_instant(
+    date_time: *const TemporalIsoDateTime,
+    offset_nanoseconds: i64,
+    out: *mut TemporalInstant,
+) -> TemporalStatus {
+    // SAFETY: Upheld by the caller.
+    let result = unsafe { read_arg(date_time) }
+        .and_then(|date_time| Ok(iso_date_time_to_instant(date_time, offset_nanoseconds)?));
+    // SAFETY: Upheld by the caller.
+    unsafe { write_result(result, out) }
+}
+
+/// Converts each of the `len` date-times at the provided UTC offset to an exact instant,
+/// writing the instants to `out`.
+///
+/// On error, the status of the first failing date-time is returned and later outputs are left unwritten.
+///
+/// # Safety
+///
+/// `date_times` must be valid for `len` reads and `out` must be valid for `len` writes.
+#[no_mangle]
+pub unsafe extern "C" fn temporal_iso_date_time_to_instant_batch(
+    date_times: *const TemporalIsoDateTime,
+    len: usize,
+    offset_nanoseconds: i64,
+    out: *mut TemporalInstant,
+) -> TemporalStatus {
+    // SAFETY: Upheld by the caller.
+    unsafe {
+        run_batch(date_times, len, out, |date_time| {
+            Ok(iso_date_time_to_instant(date_time, offset_nanoseconds)?)
+        })
+    }
+}
+
+/// Parses an RFC 9557 instant string, writing the instant to `out`.
+///
+/// # Safety
+///
+/// `source` must point to `source.len` readable bytes, and `out` must be null or valid for writes.
+#[no_mangle]
+pub unsafe extern "C" fn temporal_instant_from_utf8(
+    source: TemporalUtf8,
+    out: *mut TemporalInstant,
+) -> TemporalStatus {
+    // SAFETY: Upheld by the caller.
+    let result = unsafe { str_from_abi(source) }.and_then(|source| Ok(instant_from_str(source)?));
+    // SAFETY: Upheld by the caller.
+    unsafe { write_result(result, out) }
+}
+
+/// Parses each of the `len` RFC 9557 instant strings, writing the instants to `out`.
+///
+/// On error, the status of the first failing string is returned and later outputs are left unwritten.
+///
+/// # Safety
+///
+/// `sources` must be valid for `len` reads with each string pointing to its `len` readable
+/// bytes, and `out` must be valid for `len` writes.
+#[no_mangle]
+pub unsafe extern "C" fn temporal_instant_from_utf8_batch(
+    sources: *const TemporalUtf8,
+    len: usize,
+    out: *mut TemporalInstant,
+) -> TemporalStatus {
+    // SAFETY: Upheld by the caller.
+    unsafe {
+        run_batch(sources, len, out, |source| {
+            let source = str_from_abi(source)?;
+            Ok(instant_from_str(source)?)
+        })
+    }
+}
+
+/// Parses an ISO 8601 duration string, writing the duration to `out`.
+///
+/// # Safety
+///
+/// `source` must point to `source.len` readable bytes, and `out` must be null or valid for writes.
+#[no_mangle]
+pub unsafe extern "C" fn temporal_duration_from_utf8(
+    source: TemporalUtf8,
+    out: *mut TemporalDuration,
+) -> TemporalStatus {
+    // SAFETY: Upheld by the caller.
+    let result = unsafe { str_from_abi(source) }
+        .and_then(|source| Ok(TemporalDuration::from(&Duration::from_str(source)?)));
+    // SAFETY: Upheld by the caller.
+    unsafe { write_result(result, out) }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn utf8(source: &str) -> TemporalUtf8 {
+        TemporalUtf8 {
+            data: source.as_ptr(),
+            len: source.len(),
+        }
+    }
+
+    #[test]
+    fn instant_halves_round_trip() {
+        for nanos in [
+            0,
+            -1,
+            1,
+            NS_MAX_INSTANT,
+            NS_MIN_INSTANT,
+            i128::from(u64::MAX) + 1,
+        ] {
+            let instant = TemporalInstant::from_epoch_nanoseconds(nanos);
+            assert_eq!(instant.epoch_nanoseconds(), nanos);
+        }
+    }
+
+    #[test]
+    fn date_add_and_until() {
+        let date = TemporalIsoDate {
+            year: 2020,
+            month: 1,
+            day: 31,
+        };
+        let duration = TemporalDuration {
+            months: 1.0,
+            hours: 48.0,
+            ..Default::default()
+        };
+        let mut out = TemporalIsoDate::default();
+        let status = unsafe {
+            temporal_iso_date_add(&date, &duration, TEMPORAL_OVERFLOW_CONSTRAIN, &mut out)
+        };
+        assert_eq!(status, TemporalStatus::Ok);
+        assert_eq!((out.year, out.month, out.day), (2020, 3, 2));
+
+        let status =
+            unsafe { temporal_iso_date_add(&date, &duration, TEMPORAL_OVERFLOW_REJECT, &mut out) };
+        assert_eq!(status, TemporalStatus::RangeError);
+
+        let one = TemporalIsoDate {
+            year: 2020,
+            month: 1,
+            day: 15,
+        };
+        let two = TemporalIsoDate {
+            year: 2020,
+            month: 3,
+            day: 17,
+        };
+        let mut until = TemporalDuration::default();
+        let status = unsafe { temporal_iso_date_until(&one, &two, 9, &mut until) };
+        assert_eq!(status, TemporalStatus::Ok);
+        assert_eq!((until.months, until.days), (2.0, 2.0));
+        let status = unsafe { temporal_iso_date_until(&one, &two, 6, &mut until) };
+        assert_eq!(status, TemporalStatus::RangeError);
+
+        let status = unsafe { temporal_iso_date_add(&date, core::ptr::null(), 0, &mut out) };
+        assert_eq!(status, TemporalStatus::NullPointer);
+    }
+
+    #[test]
+    fn batch_entry_points() {
+        let dates = [(2020, 2, 29), (2021, 12, 31)].map(|(year, month, day)| TemporalIsoDate {
+            year,
+            month,
+            day,
+        });
+        let duration = TemporalDuration {
+            years: 1.0,
+            ..Default::default()
+        };
+        let mut out = [TemporalIsoDate::default(); 2];
+        let status = unsafe {
+            temporal_iso_date_add_batch(
+                dates.as_ptr(),
+                dates.len(),
+                &duration,
+                TEMPORAL_OVERFLOW_CONSTRAIN,
+                out.as_mut_ptr(),
+            )
+        };
+        assert_eq!(status, TemporalStatus::Ok);
+        assert_eq!(
+            out[0],
+            TemporalIsoDate {
+                year: 2021,
+                month: 2,
+                day: 28
+            }
+        );
+        assert_eq!(
+            out[1],
+            TemporalIsoDate {
+                year: 2022,
+                month: 12,
+                day: 31
+            }
+        );
+
+        let sources = [
+            utf8("1970-01-01T00:00Z"),
+            utf8("1970-01-01T01:00+01:00"),
+            utf8("bad"),
+        ];
+        let mut instants = [TemporalInstant::default(); 3];
+        let status =
+            unsafe { temporal_instant_from_utf8_batch(sources.as_ptr(), 2, instants.as_mut_ptr()) };
+        assert_eq!(status, TemporalStatus::Ok);
+        assert_eq!(instants[0].epoch_nanoseconds(), 0);
+        assert_eq!(instants[1].epoch_nanoseconds(), 0);
+        let status =
+            unsafe { temporal_instant_from_utf8_batch(sources.as_ptr(), 3, instants.as_mut_ptr()) };
+        assert_eq!(status, TemporalStatus::SyntaxError);
+
+        let date_times = [TemporalIsoDateTime {
+            date: TemporalIsoDate {
+                year: 1970,
+                month: 1,
+                day: 2,
+            },
+            time: TemporalIsoTime::default(),
+        }];
+        let status = unsafe {
+            temporal_iso_date_time_to_instant_batch(
+                date_times.as_ptr(),
+                1,
+                3_600_000_000_000,
+                instants.as_mut_ptr(),
+            )
+        };
+        assert_eq!(status, TemporalStatus::Ok);
+        assert_eq!(instants[0].epoch_nanoseconds(), 82_800_000_000_000);
+    }
+
+    #[test]
+    fn duration_from_utf8() {
+        let mut out = TemporalDuration::default();
+        let status = unsafe { temporal_duration_from_utf8(utf8("P1Y2DT3H"), &mut out) };
+        assert_eq!(status, TemporalStatus::Ok);
+        assert_eq!((out.years, out.days, out.hours), (1.0, 2.0, 3.0));
+    }
+}
@@ -17,16 +17,29 @@ use crate::{
     },
     iso::{IsoDate, IsoDateSlots},
     options::{ArithmeticOverflow, TemporalUnit},
-    TemporalError, TemporalFields, TemporalResult,
+    DateFields, TemporalError, TemporalFields, TemporalResult,
 };
 
 use icu_calendar::{
     types::{Era, MonthCode},
-    week::{RelativeUnit, WeekCalculator},
     AnyCalendar, AnyCalendarKind, Calendar, Iso,
 };
 use tinystr::TinyAsciiStr;
 
+mod business;
+mod cache;
+mod week;
+
+#[doc(inline)]
+pub use business::{BusinessCalendar, BusinessCalendarBuilder};
+#[doc(inline)]
+pub use cache::{
+    calendar_cache_stats, clear_calendar_cache, set_calendar_cache_capacity, CalendarCacheStats,
+    DEFAULT_CALENDAR_CACHE_CAPACITY,
+};
+#[doc(inline)]
+pub use week::{WeekOf, WeekRules};
+
 /// The ECMAScript defined protocol methods
 pub const CALENDAR_PROTOCOL_METHODS: [&str; 21] = [
     "dateAdd",
@@ -278,6 +291,26 @@ pub trait CalendarProtocol: Clone {
     ) -> TemporalResult<TemporalFields>;
     /// Debug name
     fn identifier(&self, context: &mut Self::Context) -> TemporalResult<String>;
+
+    // ==== Batched methods ====
+    //
+    // The below method has a default implementation that calls the single value method for
+    // each value. Implementors where each call is expensive (i.e. calendars backed by an engine)
+    // may override it to resolve all values in a single call.
+
+    /// Returns the `Temporal.PlainDate`s resulting from adding each of the provided durations to `date`.
+    fn date_add_durations(
+        &self,
+        date: &Date<Self>,
+        durations: &[Duration],
+        overflow: ArithmeticOverflow,
+        context: &mut Self::Context,
+    ) -> TemporalResult<Vec<Date<Self>>> {
+        durations
+            .iter()
+            .map(|duration| self.date_add(date, duration, overflow, context))
+            .collect()
+    }
 }
 
 /// A trait for retrieving an internal calendar slice.
@@ -291,16 +324,40 @@ pub trait GetCalendarSlot<C: CalendarProtocol> {
 /// The `[[Calendar]]` field slot of a Temporal Object.
 #[derive(Debug)]
 pub enum CalendarSlot<C: CalendarProtocol> {
-    /// The calendar identifier string.
-    Builtin(AnyCalendar),
+    /// The calendar identifier string, along with the source of the calendar's data.
+    Builtin(AnyCalendar, CalendarDataSource),
     /// A `CalendarProtocol` implementation.
     Protocol(C),
 }
 
+/// The source of the data of a builtin calendar.
+///
+/// Calendars with different data may disagree on the same date, so the calendar month cache
+/// only shares months between calendars with the same data source.
+#[derive(Debug, Default, Clone, Copy, PartialEq, Eq, PartialOrd, Ord, Hash)]
+pub enum CalendarDataSource {
+    /// The calendar uses compiled data, or does not require any data.
+    #[default]
+    Compiled,
+    /// The calendar's data was loaded from a data provider, identified by the load.
+    Provider(u64),
+}
+
+impl CalendarDataSource {
+    /// Returns a new `Provider` data source that is distinct from every other data source.
+    #[cfg(feature = "buffer_provider")]
+    fn new_provider() -> Self {
+        use std::sync::atomic::{AtomicU64, Ordering};
+
+        static NEXT_PROVIDER: AtomicU64 = AtomicU64::new(0);
+        Self::Provider(NEXT_PROVIDER.fetch_add(1, Ordering::Relaxed))
+    }
+}
+
 impl<C: CalendarProtocol> Clone for CalendarSlot<C> {
     fn clone(&self) -> Self {
         match self {
-            Self::Builtin(any) => {
+            Self::Builtin(any, data) => {
                 let clone = match any {
                     AnyCalendar::Buddhist(c) => AnyCalendar::Buddhist(*c),
                     AnyCalendar::Chinese(c) => AnyCalendar::Chinese(c.clone()),
@@ -323,7 +380,7 @@ impl<C: CalendarProtocol> Clone for CalendarSlot<C> {
                     AnyCalendar::Roc(c) => AnyCalendar::Roc(*c),
                     _ => unimplemented!("There is a calendar that is missing a clone impl."),
                 };
-                Self::Builtin(clone)
+                Self::Builtin(clone, *data)
             }
 
             Self::Protocol(proto) => CalendarSlot::Protocol(proto.clone()),
@@ -336,33 +393,147 @@ impl<C: CalendarProtocol> FromStr for CalendarSlot<C> {
     type Err = TemporalError;
 
     fn from_str(s: &str) -> Result<Self, Self::Err> {
-        // NOTE(nekesss): Catch the iso identifier here, as `iso8601` is not a valid ID below.
-        if s == "iso8601" {
-            return Ok(CalendarSlot::Builtin(AnyCalendar::Iso(Iso)));
-        }
+        let cal = builtin_calendar_kind(s)?;
 
-        let Some(cal) = AnyCalendarKind::get_for_bcp47_bytes(s.as_bytes()) else {
-            return Err(TemporalError::range().with_message("Not a builtin calendar."));
+        let Some(any_calendar) = new_builtin_calendar(cal) else {
+            return Err(TemporalError::range()
+                .with_message("Builtin calendar is not available in this build."));
         };
 
-        let any_calendar = AnyCalendar::new(cal);
+        Ok(CalendarSlot::Builtin(
+            any_calendar,
+            CalendarDataSource::Compiled,
+        ))
+    }
+}
 
-        Ok(CalendarSlot::Builtin(any_calendar))
+/// Returns the `AnyCalendarKind` of a builtin calendar identifier.
+fn builtin_calendar_kind(s: &str) -> TemporalResult<AnyCalendarKind> {
+    // NOTE(nekesss): Catch the iso identifier here, as `iso8601` is not a valid ID below.
+    if s == "iso8601" {
+        return Ok(AnyCalendarKind::Iso);
     }
+
+    AnyCalendarKind::get_for_bcp47_bytes(s.as_bytes())
+        .ok_or_else(|| TemporalError::range().with_message("Not a builtin calendar."))
+}
+
+/// Creates the builtin `AnyCalendar` for the provided kind, returning `None` if the calendar's
+/// data was not compiled into this build.
+///
+/// Arithmetic calendars require no data and are always available. The data driven calendars are
+/// enabled with the `astronomical_calendars` and `japanese_calendar` features.
+fn new_builtin_calendar(kind: AnyCalendarKind) -> Option<AnyCalendar> {
+    use icu_calendar::{
+        buddhist::Buddhist,
+        coptic::Coptic,
+        ethiopian::{Ethiopian, EthiopianEraStyle},
+        gregorian::Gregorian,
+        hebrew::Hebrew,
+        indian::Indian,
+        islamic::{IslamicCivil, IslamicTabular},
+        persian::Persian,
+        roc::Roc,
+    };
+
+    let calendar = match kind {
+        AnyCalendarKind::Buddhist => AnyCalendar::Buddhist(Buddhist),
+        AnyCalendarKind::Coptic => AnyCalendar::Coptic(Coptic),
+        AnyCalendarKind::Ethiopian => AnyCalendar::Ethiopian(Ethiopian::new_with_era_style(
+            EthiopianEraStyle::AmeteMihret,
+        )),
+        AnyCalendarKind::EthiopianAmeteAlem => {
+            AnyCalendar::Ethiopian(Ethiopian::new_with_era_style(EthiopianEraStyle::AmeteAlem))
+        }
+        AnyCalendarKind::Gregorian => AnyCalendar::Gregorian(Gregorian),
+        AnyCalendarKind::Hebrew => AnyCalendar::Hebrew(Hebrew::new()),
+        AnyCalendarKind::Indian => AnyCalendar::Indian(Indian),
+        AnyCalendarKind::IslamicCivil => AnyCalendar::IslamicCivil(IslamicCivil::new()),
+        AnyCalendarKind::IslamicTabular => AnyCalendar::IslamicTabular(IslamicTabular::new()),
+        AnyCalendarKind::Iso => AnyCalendar::Iso(Iso),
+        AnyCalendarKind::Persian => AnyCalendar::Persian(Persian),
+        AnyCalendarKind::Roc => AnyCalendar::Roc(Roc),
+        #[cfg(feature = "astronomical_calendars")]
+        AnyCalendarKind::Chinese
+        | AnyCalendarKind::Dangi
+        | AnyCalendarKind::IslamicObservational
+        | AnyCalendarKind::IslamicUmmAlQura => AnyCalendar::new(kind),
+        #[cfg(feature = "japanese_calendar")]
+        AnyCalendarKind::Japanese | AnyCalendarKind::JapaneseExtended => AnyCalendar::new(kind),
+        _ => return None,
+    };
+
+    Some(calendar)
 }
 
 impl<C: CalendarProtocol> Default for CalendarSlot<C> {
     fn default() -> Self {
-        Self::Builtin(AnyCalendar::Iso(Iso))
+        Self::iso()
     }
 }
 
 // ==== Public `CalendarSlot` methods ====
 
 impl<C: CalendarProtocol> CalendarSlot<C> {
+    /// Returns the builtin `ISO` calendar.
+    #[inline]
+    #[must_use]
+    pub const fn iso() -> Self {
+        Self::Builtin(AnyCalendar::Iso(Iso), CalendarDataSource::Compiled)
+    }
+
     /// Returns whether the current calendar is `ISO`
     pub fn is_iso(&self) -> bool {
-        matches!(self, CalendarSlot::Builtin(AnyCalendar::Iso(_)))
+        matches!(self, CalendarSlot::Builtin(AnyCalendar::Iso(_), _))
+    }
+}
+
+#[cfg(feature = "buffer_provider")]
+impl<C: CalendarProtocol> CalendarSlot<C> {
+    /// Creates a builtin `CalendarSlot` from a calendar identifier, loading any calendar data
+    /// that it requires from the provided `BufferProvider`.
+    ///
+    /// This allows calendar data to be supplied at runtime rather than compiled into the binary,
+    /// i.e. with a `BlobDataProvider` over a memory-mapped blob file that is shared between
+    /// processes and can be updated independently of the binary.
+    pub fn try_from_str_with_buffer_provider<P>(s: &str, provider: &P) -> TemporalResult<Self>
+    where
+        P: icu_provider::BufferProvider + ?Sized,
+    {
+        let cal = builtin_calendar_kind(s)?;
+        let any_calendar = AnyCalendar::try_new_with_buffer_provider(provider, cal)
+            .map_err(|err| TemporalError::range().with_message(err.to_string()))?;
+        Ok(CalendarSlot::Builtin(
+            any_calendar,
+            CalendarDataSource::new_provider(),
+        ))
+    }
+}
+
+#[cfg(feature = "locale_formatting")]
+impl<C: CalendarProtocol> CalendarSlot<C> {
+    /// Returns the provided `IsoDate` as an `icu_calendar` date of this builtin calendar.
+    ///
+    /// The date is built from the same calendar fields as `CalendarSlot::year`, `month_code`,
+    /// and `day`, so dates of the astronomical calendars are served from the calendar month
+    /// cache.
+    pub(crate) fn builtin_icu4x_date(
+        &self,
+        iso: IsoDate,
+    ) -> TemporalResult<icu_calendar::Date<icu_calendar::Ref<'_, AnyCalendar>>> {
+        let CalendarSlot::Builtin(builtin, data) = self else {
+            return Err(TemporalError::range().with_message("Calendar is not a builtin calendar."));
+        };
+        match cache::calendar_date(builtin, *data, iso)? {
+            cache::CalendarDate::Converted(date) => Ok(date),
+            date => Ok(icu_calendar::Date::try_new_from_codes(
+                Era(date.era()),
+                date.year(),
+                MonthCode(date.month_code()),
+                date.day(),
+                icu_calendar::Ref(builtin),
+            )?),
+        }
     }
 }
 
@@ -379,7 +550,7 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
         context: &mut C::Context,
     ) -> TemporalResult<Date<C>> {
         match self {
-            CalendarSlot::Builtin(AnyCalendar::Iso(_)) => {
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => {
                 // Resolve month and monthCode;
                 fields.iso_resolve_month()?;
                 Date::new(
@@ -390,7 +561,7 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
                     overflow,
                 )
             }
-            CalendarSlot::Builtin(builtin) => {
+            CalendarSlot::Builtin(builtin, _) => {
                 // NOTE: This might preemptively throw as `ICU4X` does not support constraining.
                 // Resolve month and monthCode;
                 let calendar_date = builtin.date_from_codes(
@@ -414,6 +585,28 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
         }
     }
 
+    /// Creates a `Date` from typed `DateFields`.
+    ///
+    /// The ISO 8601 calendar resolves the date directly from the fields, while every other
+    /// calendar resolves the equivalent `TemporalFields` with `date_from_fields`.
+    pub fn date_from_date_fields(
+        &self,
+        fields: &DateFields,
+        overflow: ArithmeticOverflow,
+        context: &mut C::Context,
+    ) -> TemporalResult<Date<C>> {
+        fields.validate_positive()?;
+        match self {
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => {
+                let (year, day) = fields.iso_year_and_day()?;
+                let month = fields.iso_month()?;
+                let iso = IsoDate::new(year, month, day, overflow)?;
+                Ok(Date::new_unchecked(iso, self.clone()))
+            }
+            _ => self.date_from_fields(&mut TemporalFields::from(*fields), overflow, context),
+        }
+    }
+
     /// `CalendarMonthDayFromFields`
     pub fn month_day_from_fields(
         &self,
@@ -422,7 +615,7 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
         context: &mut C::Context,
     ) -> TemporalResult<MonthDay<C>> {
         match self {
-            CalendarSlot::Builtin(AnyCalendar::Iso(_)) => {
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => {
                 fields.iso_resolve_month()?;
                 MonthDay::new(
                     fields.month().unwrap_or(0),
@@ -431,7 +624,7 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
                     overflow,
                 )
             }
-            CalendarSlot::Builtin(_) => {
+            CalendarSlot::Builtin(..) => {
                 // TODO: This may get complicated...
                 // For reference: https://github.com/tc39/proposal-temporal/blob/main/polyfill/lib/calendar.mjs#L1275.
                 Err(TemporalError::range().with_message("Not yet implemented/supported."))
@@ -450,7 +643,7 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
         context: &mut C::Context,
     ) -> TemporalResult<YearMonth<C>> {
         match self {
-            CalendarSlot::Builtin(AnyCalendar::Iso(_)) => {
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => {
                 fields.iso_resolve_month()?;
                 YearMonth::new(
                     fields.year().unwrap_or(0),
@@ -460,7 +653,7 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
                     overflow,
                 )
             }
-            CalendarSlot::Builtin(builtin) => {
+            CalendarSlot::Builtin(builtin, _) => {
                 // NOTE: This might preemptively throw as `ICU4X` does not support regulating.
                 let calendar_date = builtin.date_from_codes(
                     Era::from(fields.era()),
@@ -492,7 +685,7 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
         context: &mut C::Context,
     ) -> TemporalResult<Date<C>> {
         match self {
-            CalendarSlot::Builtin(AnyCalendar::Iso(_)) => {
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => {
                 // 8. Let norm be NormalizeTimeDuration(duration.[[Hours]], duration.[[Minutes]], duration.[[Seconds]],
                 // duration.[[Milliseconds]], duration.[[Microseconds]], duration.[[Nanoseconds]]).
                 // 9. Let balanceResult be BalanceTimeDuration(norm, "day").
@@ -521,7 +714,7 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
                     ArithmeticOverflow::Reject,
                 )
             }
-            CalendarSlot::Builtin(_) => {
+            CalendarSlot::Builtin(..) => {
                 Err(TemporalError::range().with_message("Not yet implemented."))
             }
             CalendarSlot::Protocol(protocol) => {
@@ -539,11 +732,11 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
         context: &mut C::Context,
     ) -> TemporalResult<Duration> {
         match self {
-            CalendarSlot::Builtin(AnyCalendar::Iso(_)) => {
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => {
                 let date_duration = one.iso.diff_iso_date(&two.iso, largest_unit)?;
                 Ok(Duration::from_date_duration(&date_duration))
             }
-            CalendarSlot::Builtin(_) => {
+            CalendarSlot::Builtin(..) => {
                 Err(TemporalError::range().with_message("Not yet implemented."))
             }
             CalendarSlot::Protocol(protocol) => {
@@ -559,11 +752,10 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
         context: &mut C::Context,
     ) -> TemporalResult<Option<TinyAsciiStr<16>>> {
         match self {
-            CalendarSlot::Builtin(AnyCalendar::Iso(_)) => Ok(None),
-            CalendarSlot::Builtin(builtin) => {
-                let calendar_date = builtin.date_from_iso(date_like.as_iso_date().as_icu4x()?);
-                Ok(Some(builtin.year(&calendar_date).era.0))
-            }
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => Ok(None),
+            CalendarSlot::Builtin(builtin, data) => Ok(Some(
+                cache::calendar_date(builtin, *data, date_like.as_iso_date())?.era(),
+            )),
             CalendarSlot::Protocol(protocol) => protocol.era(date_like, context),
         }
     }
@@ -575,11 +767,10 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
         context: &mut C::Context,
     ) -> TemporalResult<Option<i32>> {
         match self {
-            CalendarSlot::Builtin(AnyCalendar::Iso(_)) => Ok(None),
-            CalendarSlot::Builtin(builtin) => {
-                let calendar_date = builtin.date_from_iso(date_like.as_iso_date().as_icu4x()?);
-                Ok(Some(builtin.year(&calendar_date).number))
-            }
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => Ok(None),
+            CalendarSlot::Builtin(builtin, data) => Ok(Some(
+                cache::calendar_date(builtin, *data, date_like.as_iso_date())?.year(),
+            )),
             CalendarSlot::Protocol(protocol) => protocol.era_year(date_like, context),
         }
     }
@@ -591,10 +782,9 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
         context: &mut C::Context,
     ) -> TemporalResult<i32> {
         match self {
-            CalendarSlot::Builtin(AnyCalendar::Iso(_)) => Ok(date_like.as_iso_date().year),
-            CalendarSlot::Builtin(builtin) => {
-                let calendar_date = builtin.date_from_iso(date_like.as_iso_date().as_icu4x()?);
-                Ok(builtin.year(&calendar_date).number)
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => Ok(date_like.as_iso_date().year),
+            CalendarSlot::Builtin(builtin, data) => {
+                Ok(cache::calendar_date(builtin, *data, date_like.as_iso_date())?.year())
             }
             CalendarSlot::Protocol(protocol) => protocol.year(date_like, context),
         }
@@ -607,9 +797,9 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
         context: &mut C::Context,
     ) -> TemporalResult<u8> {
         match self {
-            CalendarSlot::Builtin(AnyCalendar::Iso(_)) => Ok(date_like.as_iso_date().month),
-            CalendarSlot::Builtin(_) => {
-                Err(TemporalError::range().with_message("Not yet implemented."))
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => Ok(date_like.as_iso_date().month),
+            CalendarSlot::Builtin(builtin, data) => {
+                Ok(cache::calendar_date(builtin, *data, date_like.as_iso_date())?.month())
             }
             CalendarSlot::Protocol(protocol) => protocol.month(date_like, context),
         }
@@ -622,11 +812,11 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
         context: &mut C::Context,
     ) -> TemporalResult<TinyAsciiStr<4>> {
         match self {
-            CalendarSlot::Builtin(AnyCalendar::Iso(_)) => {
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => {
                 Ok(date_like.as_iso_date().as_icu4x()?.month().code.0)
             }
-            CalendarSlot::Builtin(_) => {
-                Err(TemporalError::range().with_message("Not yet implemented."))
+            CalendarSlot::Builtin(builtin, data) => {
+                Ok(cache::calendar_date(builtin, *data, date_like.as_iso_date())?.month_code())
             }
             CalendarSlot::Protocol(protocol) => protocol.month_code(date_like, context),
         }
@@ -639,9 +829,9 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
         context: &mut C::Context,
     ) -> TemporalResult<u8> {
         match self {
-            CalendarSlot::Builtin(AnyCalendar::Iso(_)) => Ok(date_like.as_iso_date().day),
-            CalendarSlot::Builtin(_) => {
-                Err(TemporalError::range().with_message("Not yet implemented."))
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => Ok(date_like.as_iso_date().day),
+            CalendarSlot::Builtin(builtin, data) => {
+                Ok(cache::calendar_date(builtin, *data, date_like.as_iso_date())?.day())
             }
             CalendarSlot::Protocol(protocol) => protocol.day(date_like, context),
         }
@@ -654,10 +844,10 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
         context: &mut C::Context,
     ) -> TemporalResult<u16> {
         match self {
-            CalendarSlot::Builtin(AnyCalendar::Iso(_)) => {
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => {
                 Ok(date_like.as_iso_date().as_icu4x()?.day_of_week() as u16)
             }
-            CalendarSlot::Builtin(_) => {
+            CalendarSlot::Builtin(..) => {
                 Err(TemporalError::range().with_message("Not yet implemented."))
             }
             CalendarSlot::Protocol(protocol) => protocol.day_of_week(date_like, context),
@@ -671,12 +861,12 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
         context: &mut C::Context,
     ) -> TemporalResult<u16> {
         match self {
-            CalendarSlot::Builtin(AnyCalendar::Iso(_)) => Ok(date_like
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => Ok(date_like
                 .as_iso_date()
                 .as_icu4x()?
                 .day_of_year_info()
                 .day_of_year),
-            CalendarSlot::Builtin(_) => {
+            CalendarSlot::Builtin(..) => {
                 Err(TemporalError::range().with_message("Not yet implemented."))
             }
             CalendarSlot::Protocol(protocol) => protocol.day_of_year(date_like, context),
@@ -690,18 +880,13 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
         context: &mut C::Context,
     ) -> TemporalResult<u16> {
         match self {
-            CalendarSlot::Builtin(AnyCalendar::Iso(_)) => {
-                let date = date_like.as_iso_date().as_icu4x()?;
-
-                let week_calculator = WeekCalculator::default();
-
-                let week_of = date
-                    .week_of_year(&week_calculator)
-                    .map_err(|err| TemporalError::range().with_message(err.to_string()))?;
-
-                Ok(week_of.week)
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => {
+                let iso = date_like.as_iso_date();
+                Ok(WeekRules::ISO
+                    .week_of_iso_date(iso.year, iso.month, iso.day)
+                    .week)
             }
-            CalendarSlot::Builtin(_) => {
+            CalendarSlot::Builtin(..) => {
                 Err(TemporalError::range().with_message("Not yet implemented."))
             }
             CalendarSlot::Protocol(protocol) => protocol.week_of_year(date_like, context),
@@ -715,22 +900,13 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
         context: &mut C::Context,
     ) -> TemporalResult<i32> {
         match self {
-            CalendarSlot::Builtin(AnyCalendar::Iso(_)) => {
-                let date = date_like.as_iso_date().as_icu4x()?;
-
-                let week_calculator = WeekCalculator::default();
-
-                let week_of = date
-                    .week_of_year(&week_calculator)
-                    .map_err(|err| TemporalError::range().with_message(err.to_string()))?;
-
-                match week_of.unit {
-                    RelativeUnit::Previous => Ok(date.year().number - 1),
-                    RelativeUnit::Current => Ok(date.year().number),
-                    RelativeUnit::Next => Ok(date.year().number + 1),
-                }
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => {
+                let iso = date_like.as_iso_date();
+                Ok(WeekRules::ISO
+                    .week_of_iso_date(iso.year, iso.month, iso.day)
+                    .year)
             }
-            CalendarSlot::Builtin(_) => {
+            CalendarSlot::Builtin(..) => {
                 Err(TemporalError::range().with_message("Not yet implemented."))
             }
             CalendarSlot::Protocol(protocol) => protocol.year_of_week(date_like, context),
@@ -744,8 +920,8 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
         context: &mut C::Context,
     ) -> TemporalResult<u16> {
         match self {
-            CalendarSlot::Builtin(AnyCalendar::Iso(_)) => Ok(7),
-            CalendarSlot::Builtin(_) => {
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => Ok(7),
+            CalendarSlot::Builtin(..) => {
                 Err(TemporalError::range().with_message("Not yet implemented."))
             }
             CalendarSlot::Protocol(protocol) => protocol.days_in_week(date_like, context),
@@ -759,13 +935,13 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
         context: &mut C::Context,
     ) -> TemporalResult<u16> {
         match self {
-            CalendarSlot::Builtin(AnyCalendar::Iso(_)) => {
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => {
                 // NOTE: Cast shouldn't fail in this instance.
                 Ok(date_like.as_iso_date().as_icu4x()?.days_in_month() as u16)
             }
-            CalendarSlot::Builtin(_) => {
-                Err(TemporalError::range().with_message("Not yet implemented."))
-            }
+            CalendarSlot::Builtin(builtin, data) => Ok(u16::from(
+                cache::calendar_date(builtin, *data, date_like.as_iso_date())?.days_in_month(),
+            )),
             CalendarSlot::Protocol(protocol) => protocol.days_in_month(date_like, context),
         }
     }
@@ -777,10 +953,10 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
         context: &mut C::Context,
     ) -> TemporalResult<u16> {
         match self {
-            CalendarSlot::Builtin(AnyCalendar::Iso(_)) => {
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => {
                 Ok(date_like.as_iso_date().as_icu4x()?.days_in_year())
             }
-            CalendarSlot::Builtin(_) => {
+            CalendarSlot::Builtin(..) => {
                 Err(TemporalError::range().with_message("Not yet implemented."))
             }
             CalendarSlot::Protocol(protocol) => protocol.days_in_year(date_like, context),
@@ -794,8 +970,8 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
         context: &mut C::Context,
     ) -> TemporalResult<u16> {
         match self {
-            CalendarSlot::Builtin(AnyCalendar::Iso(_)) => Ok(12),
-            CalendarSlot::Builtin(_) => {
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => Ok(12),
+            CalendarSlot::Builtin(..) => {
                 Err(TemporalError::range().with_message("Not yet implemented."))
             }
             CalendarSlot::Protocol(protocol) => protocol.months_in_year(date_like, context),
@@ -809,10 +985,10 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
         context: &mut C::Context,
     ) -> TemporalResult<bool> {
         match self {
-            CalendarSlot::Builtin(AnyCalendar::Iso(_)) => {
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => {
                 Ok(date_like.as_iso_date().as_icu4x()?.is_in_leap_year())
             }
-            CalendarSlot::Builtin(_) => {
+            CalendarSlot::Builtin(..) => {
                 Err(TemporalError::range().with_message("Not yet implemented."))
             }
             CalendarSlot::Protocol(protocol) => protocol.in_leap_year(date_like, context),
@@ -826,8 +1002,8 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
         context: &mut C::Context,
     ) -> TemporalResult<Vec<String>> {
         match self {
-            CalendarSlot::Builtin(AnyCalendar::Iso(_)) => Ok(fields),
-            CalendarSlot::Builtin(_) => {
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => Ok(fields),
+            CalendarSlot::Builtin(..) => {
                 Err(TemporalError::range().with_message("Not yet implemented."))
             }
             CalendarSlot::Protocol(protocol) => protocol.fields(fields, context),
@@ -842,7 +1018,7 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
         context: &mut C::Context,
     ) -> TemporalResult<TemporalFields> {
         match self {
-            CalendarSlot::Builtin(_) => fields.merge_fields(additional_fields, self),
+            CalendarSlot::Builtin(..) => fields.merge_fields(additional_fields, self),
             CalendarSlot::Protocol(protocol) => {
                 protocol.merge_fields(fields, additional_fields, context)
             }
@@ -852,13 +1028,36 @@ impl<C: CalendarProtocol> CalendarSlot<C> {
     /// Returns the identifier of this calendar slot.
     pub fn identifier(&self, context: &mut C::Context) -> TemporalResult<String> {
         match self {
-            CalendarSlot::Builtin(AnyCalendar::Iso(_)) => Ok(String::from("iso8601")),
-            CalendarSlot::Builtin(builtin) => Ok(String::from(builtin.debug_name())),
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => Ok(String::from("iso8601")),
+            CalendarSlot::Builtin(builtin, _) => Ok(String::from(builtin.debug_name())),
             CalendarSlot::Protocol(protocol) => protocol.identifier(context),
         }
     }
 }
 
+// ==== Batched CalendarSlot methods ====
+
+impl<C: CalendarProtocol> CalendarSlot<C> {
+    /// Returns the `Temporal.PlainDate`s resulting from adding each of the provided durations to `date`.
+    pub fn date_add_durations(
+        &self,
+        date: &Date<C>,
+        durations: &[Duration],
+        overflow: ArithmeticOverflow,
+        context: &mut C::Context,
+    ) -> TemporalResult<Vec<Date<C>>> {
+        match self {
+            CalendarSlot::Builtin(..) => durations
+                .iter()
+                .map(|duration| self.date_add(date, duration, overflow, context))
+                .collect(),
+            CalendarSlot::Protocol(protocol) => {
+                protocol.date_add_durations(date, durations, overflow, context)
+            }
+        }
+    }
+}
+
 impl<C: CalendarProtocol> CalendarSlot<C> {
     /// Returns the designated field descriptors for builtin calendars.
     pub fn field_descriptors(
@@ -1050,6 +1249,111 @@ impl CalendarProtocol for () {
 mod tests {
     use super::*;
 
+    #[test]
+    fn builtin_calendar_availability() {
+        for id in [
+            "iso8601", "gregory", "buddhist", "coptic", "hebrew", "persian", "roc",
+        ] {
+            assert!(
+                CalendarSlot::<()>::from_str(id).is_ok(),
+                "{id} should be available"
+            );
+        }
+        assert!(CalendarSlot::<()>::from_str("not-a-calendar").is_err());
+
+        let japanese = CalendarSlot::<()>::from_str("japanese");
+        assert_eq!(japanese.is_ok(), cfg!(feature = "japanese_calendar"));
+        let chinese = CalendarSlot::<()>::from_str("chinese");
+        assert_eq!(chinese.is_ok(), cfg!(feature = "astronomical_calendars"));
+    }
+
+    #[cfg(feature = "buffer_provider")]
+    #[test]
+    fn builtin_calendar_from_buffer_provider() {
+        let provider = icu_provider::empty::EmptyDataProvider::new();
+
+        // Arithmetic calendars do not load any data.
+        let iso = CalendarSlot::<()>::try_from_str_with_buffer_provider("iso8601", &provider);
+        assert!(iso.is_ok_and(|slot| slot.is_iso()));
+        let gregory = CalendarSlot::<()>::try_from_str_with_buffer_provider("gregory", &provider);
+        assert!(gregory.is_ok());
+
+        // Japanese era data is missing from the provider.
+        let japanese = CalendarSlot::<()>::try_from_str_with_buffer_provider("japanese", &provider);
+        assert!(japanese.is_err());
+    }
+
+    #[cfg(feature = "astronomical_calendars")]
+    #[test]
+    fn cached_astronomical_months() {
+        let calendar = CalendarSlot::<()>::from_str("chinese").unwrap();
+        let date_like = |day| {
+            let date = Date::<()>::new(2024, 3, day, calendar.clone(), ArithmeticOverflow::Reject)
+                .unwrap();
+            CalendarDateLike::Date(date)
+        };
+
+        let first = calendar.year(&date_like(10), &mut ()).unwrap();
+        let hits = calendar_cache_stats().hits;
+        // 2024-03-10 and 2024-03-20 fall within the same Chinese month.
+        assert_eq!(calendar.year(&date_like(20), &mut ()).unwrap(), first);
+        assert!(calendar_cache_stats().hits > hits);
+        assert_eq!(
+            calendar.era(&date_like(20), &mut ()).unwrap(),
+            calendar.era(&date_like(10), &mut ()).unwrap()
+        );
+        // The remaining fields are offsets into the cached month.
+        let hits = calendar_cache_stats().hits;
+        let first = date_like(10);
+        let second = date_like(20);
+        assert_eq!(
+            calendar.month_code(&second, &mut ()).unwrap(),
+            calendar.month_code(&first, &mut ()).unwrap()
+        );
+        assert_eq!(
+            calendar.month(&second, &mut ()).unwrap(),
+            calendar.month(&first, &mut ()).unwrap()
+        );
+        assert_eq!(
+            calendar.day(&second, &mut ()).unwrap(),
+            calendar.day(&first, &mut ()).unwrap() + 10
+        );
+        assert!(calendar_cache_stats().hits >= hits + 6);
+    }
+
+    #[test]
+    fn builtin_calendar_fields() {
+        let calendar = CalendarSlot::<()>::from_str("gregory").unwrap();
+        let date =
+            Date::<()>::new(2024, 3, 20, calendar.clone(), ArithmeticOverflow::Reject).unwrap();
+        let date_like = CalendarDateLike::Date(date);
+        assert_eq!(calendar.year(&date_like, &mut ()).unwrap(), 2024);
+        assert_eq!(calendar.month(&date_like, &mut ()).unwrap(), 3);
+        assert_eq!(
+            calendar.month_code(&date_like, &mut ()).unwrap().as_str(),
+            "M03"
+        );
+        assert_eq!(calendar.day(&date_like, &mut ()).unwrap(), 20);
+        assert_eq!(calendar.days_in_month(&date_like, &mut ()).unwrap(), 31);
+    }
+
+    #[test]
+    fn batched_iso_methods() {
+        let calendar = CalendarSlot::<()>::from_str("iso8601").unwrap();
+        let date =
+            Date::<()>::new(2020, 2, 29, calendar.clone(), ArithmeticOverflow::Reject).unwrap();
+
+        let durations = [-1.0, 0.0, 1.0].map(Duration::one_year);
+        let added = calendar
+            .date_add_durations(&date, &durations, ArithmeticOverflow::Constrain, &mut ())
+            .unwrap();
+        let added = added
+            .iter()
+            .map(|date| (date.iso_year(), date.iso_month(), date.iso_day()))
+            .collect::<Vec<_>>();
+        assert_eq!(added, vec![(2019, 2, 28), (2020, 2, 29), (2021, 2, 28)]);
+    }
+
     #[test]
     fn date_until_largest_year() {
         // tests format: (Date one, Date two, Duration result)
@@ -0,0 +1,590 @@
+//! This module implements a business day calendar backed by a bitmap of business days.
+//!
+//! A `BusinessCalendar` stores a bitmap with one bit per day for each year that contains a
+//! holiday. Counting and stepping over business days within those years works a 64 day word at
+//! a time with `count_ones`, while the days of every other year only follow the weekly rules
+//! and are handled a whole week at a time.
+
+use std::{path::Path, str::FromStr};
+
+use crate::{
+    components::{calendar::CalendarProtocol, Date},
+    iso::IsoDate,
+    options::ArithmeticOverflow,
+    utils, TemporalError, TemporalResult,
+};
+
+// NOTE: Any valid date is within this many days of any other valid date.
+const MAX_BUSINESS_DAYS: u64 = 200_000_002;
+
+/// A calendar of business days defined by a set of weekend days and holidays.
+///
+/// A `BusinessCalendar` is created with a `BusinessCalendarBuilder`.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct BusinessCalendar {
+    /// Bit `i` is set if ISO weekday `i + 1` is a business day.
+    weekdays: u8,
+    /// The number of business days in a week.
+    per_week: i64,
+    /// The bitmaps of the years that contain a holiday, in ascending order.
+    years: Vec<YearBitmap>,
+}
+
+/// The business days of a single year that contains a holiday.
+#[derive(Debug, Clone, PartialEq, Eq)]
+struct YearBitmap {
+    /// The epoch day of January 1st.
+    start: i64,
+    /// The number of days in the year.
+    days: i64,
+    /// Bit `i` is set if `start + i` is a business day. Bits past the end of the year are unset.
+    bits: [u64; 6],
+}
+
+/// A builder for a `BusinessCalendar`.
+///
+/// The builder defaults to a Saturday and Sunday weekend with no holidays.
+#[derive(Debug, Clone)]
+pub struct BusinessCalendarBuilder {
+    weekdays: u8,
+    holidays: Vec<i64>,
+}
+
+impl Default for BusinessCalendarBuilder {
+    fn default() -> Self {
+        Self {
+            weekdays: 0b001_1111,
+            holidays: Vec::new(),
+        }
+    }
+}
+
+impl BusinessCalendarBuilder {
+    /// Creates a new `BusinessCalendarBuilder`.
+    #[must_use]
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Sets the weekend to the provided ISO days of the week, from 1 (Monday) to 7 (Sunday).
+    pub fn weekend(mut self, weekend: &[u8]) -> TemporalResult<Self> {
+        let mut weekdays = 0b111_1111;
+        for day in weekend {
+            if !(1..=7).contains(day) {
+                return Err(TemporalError::range().with_message("Invalid weekend day of the week."));
+            }
+            weekdays &= !(1 << (day - 1));
+        }
+        if weekdays == 0 {
+            return Err(TemporalError::range()
+                .with_message("A BusinessCalendar requires at least one business weekday."));
+        }
+        self.weekdays = weekdays;
+        Ok(self)
+    }
+
+    /// Adds a holiday.
+    #[must_use]
+    pub fn holiday<C: CalendarProtocol>(mut self, date: &Date<C>) -> Self {
+        self.holidays.push(epoch_days(date.iso));
+        self
+    }
+
+    /// Adds the holidays listed in `source`, which holds one ISO 8601 date per line. Empty
+    /// lines and lines beginning with `#` are ignored.
+    pub fn holidays_from_str(mut self, source: &str) -> TemporalResult<Self> {
+        for line in source.lines().map(str::trim) {
+            if line.is_empty() || line.starts_with('#') {
+                continue;
+            }
+            let date = Date::<()>::from_str(line)?;
+            self.holidays.push(epoch_days(date.iso));
+        }
+        Ok(self)
+    }
+
+    /// Adds the holidays listed in the file at `path`. See `holidays_from_str` for the format.
+    pub fn holidays_from_file<P: AsRef<Path>>(self, path: P) -> TemporalResult<Self> {
+        let source = std::fs::read_to_string(path)
+            .map_err(|e| TemporalError::general(format!("Unable to read holiday file: {e}")))?;
+        self.holidays_from_str(&source)
+    }
+
+    /// Builds the `BusinessCalendar`.
+    #[must_use]
+    pub fn build(mut self) -> BusinessCalendar {
+        let weekdays = self.weekdays;
+        let words = week_words(weekdays);
+        self.holidays.sort_unstable();
+
+        let mut years: Vec<YearBitmap> = Vec::new();
+        for holiday in self.holidays {
+            if !matches!(years.last(), Some(year) if holiday < year.end()) {
+                years.push(YearBitmap::new(start_of_year(holiday), &words));
+            }
+            if let Some(year) = years.last_mut() {
+                let bit = (holiday - year.start) as usize;
+                year.bits[bit / 64] &= !(1 << (bit % 64));
+            }
+        }
+
+        BusinessCalendar {
+            weekdays,
+            per_week: i64::from(weekdays.count_ones()),
+            years,
+        }
+    }
+}
+
+// ==== Public API ====
+
+impl BusinessCalendar {
+    /// Returns a new `BusinessCalendarBuilder`.
+    #[must_use]
+    pub fn builder() -> BusinessCalendarBuilder {
+        BusinessCalendarBuilder::new()
+    }
+
+    /// Returns whether the provided date is a business day.
+    #[must_use]
+    pub fn is_business_day<C: CalendarProtocol>(&self, date: &Date<C>) -> bool {
+        self.is_business(epoch_days(date.iso))
+    }
+
+    /// Returns the first business day after the provided date.
+    pub fn next_business_day<C: CalendarProtocol>(
+        &self,
+        date: &Date<C>,
+    ) -> TemporalResult<Date<C>> {
+        self.add_business_days(date, 1)
+    }
+
+    /// Returns the first business day before the provided date.
+    pub fn previous_business_day<C: CalendarProtocol>(
+        &self,
+        date: &Date<C>,
+    ) -> TemporalResult<Date<C>> {
+        self.add_business_days(date, -1)
+    }
+
+    /// Adds a number of business days to the provided date. A positive `days` returns the
+    /// `days`th business day after `date`, and a negative `days` returns the business day the
+    /// same number of business days before it.
+    pub fn add_business_days<C: CalendarProtocol>(
+        &self,
+        date: &Date<C>,
+        days: i64,
+    ) -> TemporalResult<Date<C>> {
+        if days.unsigned_abs() > MAX_BUSINESS_DAYS {
+            return Err(TemporalError::range()
+                .with_message("Business days are outside of the valid date range."));
+        }
+        let start = epoch_days(date.iso);
+        let result = match days {
+            0 => start,
+            1.. => self.nth_after(start, days),
+            _ => self.nth_before(start, -days),
+        };
+
+        let (year, month, day) = utils::gregorian_date_from_epoch_days(result);
+        let iso = IsoDate::new(year, month.into(), day.into(), ArithmeticOverflow::Reject)?;
+        Ok(Date::new_unchecked(iso, date.calendar().clone()))
+    }
+
+    /// Returns the number of business days from `start` up to, but not including, `end`. The
+    /// result is negative if `end` is before `start`.
+    #[must_use]
+    pub fn business_days_between<C: CalendarProtocol>(
+        &self,
+        start: &Date<C>,
+        end: &Date<C>,
+    ) -> i64 {
+        let (start, end) = (epoch_days(start.iso), epoch_days(end.iso));
+        if start <= end {
+            self.count(start, end)
+        } else {
+            -self.count(end, start)
+        }
+    }
+}
+
+// ==== Private API ====
+
+impl BusinessCalendar {
+    fn is_business(&self, day: i64) -> bool {
+        let index = self.years.partition_point(|year| year.end() <= day);
+        match self.years.get(index) {
+            Some(year) if year.start <= day => year.is_business((day - year.start) as usize),
+            _ => self.is_business_weekday(day),
+        }
+    }
+
+    #[inline]
+    fn is_business_weekday(&self, day: i64) -> bool {
+        self.weekdays & (1 << weekday(day)) != 0
+    }
+
+    /// Counts the business days in `start..end`.
+    fn count(&self, start: i64, end: i64) -> i64 {
+        let first = self.years.partition_point(|year| year.end() <= start);
+        let (mut day, mut count) = (start, 0);
+        for year in &self.years[first..] {
+            if year.start >= end {
+                break;
+            }
+            // Before the year.
+            if day < year.start {
+                count += self.weekly_count(day, year.start);
+                day = year.start;
+            }
+            // Within the year.
+            let hi = end.min(year.end());
+            count += year.count((day - year.start) as usize, (hi - year.start) as usize);
+            day = hi;
+        }
+        // After the last year.
+        count + self.weekly_count(day, end)
+    }
+
+    /// Counts the business weekdays in `start..end`.
+    fn weekly_count(&self, start: i64, end: i64) -> i64 {
+        let days = end - start;
+        let remainder = (0..days % 7)
+            .filter(|i| self.is_business_weekday(start + i))
+            .count() as i64;
+        days / 7 * self.per_week + remainder
+    }
+
+    /// Returns the `n`th business day after `day`, where `n` is positive.
+    fn nth_after(&self, mut day: i64, mut n: i64) -> i64 {
+        let first = self.years.partition_point(|year| year.end() <= day + 1);
+        for year in &self.years[first..] {
+            // Before the year.
+            if day + 1 < year.start {
+                let available = self.weekly_count(day + 1, year.start);
+                if available >= n {
+                    return self.weekly_nth_after(day, n);
+                }
+                n -= available;
+                day = year.start - 1;
+            }
+            // Within the year.
+            match year.nth_after((day + 1 - year.start) as usize, n) {
+                Ok(result) => return result,
+                Err(remaining) => n = remaining,
+            }
+            day = year.end() - 1;
+        }
+        // After the last year.
+        self.weekly_nth_after(day, n)
+    }
+
+    /// Returns the `n`th business day before `day`, where `n` is positive.
+    fn nth_before(&self, mut day: i64, mut n: i64) -> i64 {
+        let last = self.years.partition_point(|year| year.start < day);
+        for year in self.years[..last].iter().rev() {
+            // After the year.
+            if day > year.end() {
+                let available = self.weekly_count(year.end(), day);
+                if available >= n {
+                    return self.weekly_nth_before(day, n);
+                }
+                n -= available;
+                day = year.end();
+            }
+            // Within the year.
+            match year.nth_before((day - 1 - year.start) as usize, n) {
+                Ok(result) => return result,
+                Err(remaining) => n = remaining,
+            }
+            day = year.start;
+        }
+        // Before the first year.
+        self.weekly_nth_before(day, n)
+    }
+
+    /// Returns the `n`th business weekday after `day`, skipping whole weeks.
+    fn weekly_nth_after(&self, day: i64, n: i64) -> i64 {
+        let weeks = (n - 1) / self.per_week;
+        let (mut day, mut n) = (day + weeks * 7, n - weeks * self.per_week);
+        loop {
+            day += 1;
+            if self.is_business_weekday(day) {
+                n -= 1;
+                if n == 0 {
+                    return day;
+                }
+            }
+        }
+    }
+
+    /// Returns the `n`th business weekday before `day`, skipping whole weeks.
+    fn weekly_nth_before(&self, day: i64, n: i64) -> i64 {
+        let weeks = (n - 1) / self.per_week;
+        let (mut day, mut n) = (day - weeks * 7, n - weeks * self.per_week);
+        loop {
+            day -= 1;
+            if self.is_business_weekday(day) {
+                n -= 1;
+                if n == 0 {
+                    return day;
+                }
+            }
+        }
+    }
+}
+
+// ==== YearBitmap ====
+
+impl YearBitmap {
+    /// Creates the bitmap of the year starting at `start` that only follows the weekly rules.
+    fn new(start: i64, words: &[u64; 7]) -> Self {
+        let days = if is_leap_year(start) { 366 } else { 365 };
+        let mut bits = [0; 6];
+        for (index, word) in bits.iter_mut().enumerate() {
+            let word_start = start + index as i64 * 64;
+            *word = words[weekday(word_start) as usize];
+            let remaining = days - index as i64 * 64;
+            if remaining < 64 {
+                *word &= (1 << remaining) - 1;
+            }
+        }
+        Self { start, days, bits }
+    }
+
+    /// Returns the exclusive end of the year in epoch days.
+    #[inline]
+    fn end(&self) -> i64 {
+        self.start + self.days
+    }
+
+    #[inline]
+    fn is_business(&self, bit: usize) -> bool {
+        self.bits[bit / 64] & (1 << (bit % 64)) != 0
+    }
+
+    /// Counts the set bits in the bit range `lo..hi`.
+    fn count(&self, lo: usize, hi: usize) -> i64 {
+        if lo >= hi {
+            return 0;
+        }
+        let (first_word, last_word) = (lo / 64, (hi - 1) / 64);
+        let low_mask = u64::MAX << (lo % 64);
+        let high_mask = u64::MAX >> (63 - (hi - 1) % 64);
+        if first_word == last_word {
+            return i64::from((self.bits[first_word] & low_mask & high_mask).count_ones());
+        }
+        let middle = self.bits[first_word + 1..last_word]
+            .iter()
+            .map(|word| i64::from(word.count_ones()))
+            .sum::<i64>();
+        i64::from((self.bits[first_word] & low_mask).count_ones())
+            + middle
+            + i64::from((self.bits[last_word] & high_mask).count_ones())
+    }
+
+    /// Returns the epoch day of the `n`th set bit from `bit` onwards, skipping whole words, or
+    /// the number of business days that remain after the end of the year.
+    fn nth_after(&self, bit: usize, mut n: i64) -> Result<i64, i64> {
+        let mut index = bit / 64;
+        let mut word = self.bits[index] & (u64::MAX << (bit % 64));
+        loop {
+            let ones = i64::from(word.count_ones());
+            if ones >= n {
+                for _ in 1..n {
+                    word &= word - 1;
+                }
+                return Ok(self.start + (index * 64) as i64 + i64::from(word.trailing_zeros()));
+            }
+            n -= ones;
+            index += 1;
+            let Some(next) = self.bits.get(index) else {
+                return Err(n);
+            };
+            word = *next;
+        }
+    }
+
+    /// Returns the epoch day of the `n`th set bit from `bit` backwards, skipping whole words,
+    /// or the number of business days that remain before the start of the year.
+    fn nth_before(&self, bit: usize, mut n: i64) -> Result<i64, i64> {
+        let mut index = bit / 64;
+        let mut word = self.bits[index] & (u64::MAX >> (63 - bit % 64));
+        loop {
+            let ones = i64::from(word.count_ones());
+            if ones >= n {
+                for _ in 1..n {
+                    word &= !(1 << (63 - word.leading_zeros()));
+                }
+                return Ok(self.start + (index * 64) as i64 + i64::from(63 - word.leading_zeros()));
+            }
+            n -= ones;
+            if index == 0 {
+                return Err(n);
+            }
+            index -= 1;
+            word = self.bits[index];
+        }
+    }
+}
+
+// ==== Utility functions ====
+
+/// Returns the 64 day words of the business weekdays, indexed by the weekday of their first day.
+fn week_words(weekdays: u8) -> [u64; 7] {
+    let weekdays = u64::from(weekdays);
+    core::array::from_fn(|first| {
+        // Bit `i` of the pattern is set if the weekday `first + i` is a business day.
+        let pattern = (weekdays >> first | weekdays << (7 - first)) & 0x7f;
+        (0..64)
+            .step_by(7)
+            .fold(0, |word, shift| word | pattern << shift)
+    })
+}
+
+#[inline]
+fn epoch_days(iso: IsoDate) -> i64 {
+    utils::epoch_days_from_gregorian_date(iso.year, iso.month, iso.day)
+}
+
+/// Returns the 0-based ISO day of the week, where 0 is Monday.
+#[inline]
+fn weekday(day: i64) -> i64 {
+    // NOTE: 1970-01-01 was a Thursday.
+    (day + 3).rem_euclid(7)
+}
+
+#[inline]
+fn year_of(day: i64) -> i32 {
+    utils::gregorian_date_from_epoch_days(day).0
+}
+
+#[inline]
+fn start_of_year(day: i64) -> i64 {
+    utils::epoch_days_from_gregorian_date(year_of(day), 1, 1)
+}
+
+#[inline]
+fn is_leap_year(day: i64) -> bool {
+    utils::is_gregorian_leap_year(year_of(day))
+}
+
+#[cfg(test)]
+mod tests {
+    use std::str::FromStr;
+
+    use super::{epoch_days, weekday, BusinessCalendar};
+    use crate::components::Date;
+
+    fn date(s: &str) -> Date<()> {
+        Date::from_str(s).unwrap()
+    }
+
+    #[test]
+    fn business_day_queries() {
+        let calendar = BusinessCalendar::builder()
+            .holidays_from_str("# Holidays\n2024-12-25\n\n2024-12-26\n2025-01-01\n")
+            .unwrap()
+            .build();
+
+        assert!(calendar.is_business_day(&date("2024-12-24")));
+        assert!(!calendar.is_business_day(&date("2024-12-25")));
+        assert!(!calendar.is_business_day(&date("2024-12-28")));
+
+        let next = calendar.next_business_day(&date("2024-12-24")).unwrap();
+        assert_eq!(next.iso, date("2024-12-27").iso);
+        let previous = calendar.previous_business_day(&date("2025-01-02")).unwrap();
+        assert_eq!(previous.iso, date("2024-12-31").iso);
+        let added = calendar.add_business_days(&date("2024-12-20"), 6).unwrap();
+        assert_eq!(added.iso, date("2025-01-02").iso);
+
+        assert_eq!(
+            calendar.business_days_between(&date("2024-12-01"), &date("2025-01-01")),
+            20
+        );
+        assert_eq!(
+            calendar.business_days_between(&date("2025-01-01"), &date("2024-12-01")),
+            -20
+        );
+
+        assert!(calendar
+            .add_business_days(&date("+275760-09-10"), 10)
+            .is_err());
+        assert!(BusinessCalendar::builder()
+            .weekend(&[1, 2, 3, 4, 5, 6, 7])
+            .is_err());
+        assert!(BusinessCalendar::builder().weekend(&[0]).is_err());
+        assert!(BusinessCalendar::builder()
+            .holidays_from_str("2024-02-30")
+            .is_err());
+    }
+
+    /// Compares a `BusinessCalendar` against a naive walk over `start..end`.
+    fn assert_matches_naive(weekend: &[u8], holidays: &[String], start: &str, end: &str) {
+        let mut builder = BusinessCalendar::builder().weekend(weekend).unwrap();
+        for holiday in holidays {
+            builder = builder.holiday(&date(holiday));
+        }
+        let calendar = builder.build();
+
+        let (start, end) = (epoch_days(date(start).iso), epoch_days(date(end).iso));
+        let holidays = holidays
+            .iter()
+            .map(|holiday| epoch_days(date(holiday).iso))
+            .collect::<Vec<_>>();
+        let business = (start..end)
+            .filter(|day| !weekend.contains(&(weekday(*day) as u8 + 1)) && !holidays.contains(day))
+            .collect::<Vec<_>>();
+        assert_eq!(calendar.count(start, end), business.len() as i64);
+        for (i, day) in business.iter().enumerate() {
+            assert!(calendar.is_business(*day));
+            if i % 97 != 0 {
+                continue;
+            }
+            for n in [1, 2, 63, 64, 65, 700, 3000] {
+                if let Some(expected) = business.get(i + n) {
+                    assert_eq!(calendar.nth_after(*day, n as i64), *expected);
+                }
+                if let Some(expected) = i.checked_sub(n).map(|j| business[j]) {
+                    assert_eq!(calendar.nth_before(*day, n as i64), expected);
+                }
+            }
+            assert_eq!(calendar.count(start, *day), i as i64);
+            assert_eq!(calendar.count(*day, end), (business.len() - i) as i64);
+        }
+    }
+
+    #[test]
+    fn matches_day_by_day_iteration() {
+        // A Friday and Saturday weekend with holidays in every year of a decade, compared over
+        // a multi-decade range around the holidays.
+        let holidays = (2000..2010)
+            .flat_map(|year| {
+                ["01-01", "03-17", "07-04", "12-25", "12-31"].map(|day| format!("{year}-{day}"))
+            })
+            .collect::<Vec<_>>();
+        assert_matches_naive(&[5, 6], &holidays, "1990-01-01", "2020-01-01");
+    }
+
+    #[test]
+    fn sparse_holiday_years() {
+        // Years with holidays are separated by years that only follow the weekly rules, and
+        // 1996 and 1997 are adjacent.
+        let holidays = [
+            "1995-07-04",
+            "1996-02-29",
+            "1996-12-31",
+            "1997-01-01",
+            "2003-05-05",
+            "2015-11-11",
+        ]
+        .map(String::from);
+        assert_matches_naive(&[6, 7], &holidays, "1990-01-01", "2020-01-01");
+
+        let calendar = BusinessCalendar::builder()
+            .holidays_from_str("1995-07-04\n2015-11-11\n")
+            .unwrap()
+            .build();
+        assert_eq!(calendar.years.len(), 2);
+    }
+}
@@ -0,0 +1,377 @@
+//! This module implements a bounded cache of calendar months for the astronomical calendars.
+//!
+//! Converting an ISO date into the Chinese, Dangi, or observational Islamic calendars requires
+//! an expensive astronomical calculation. Dates that fall in a month that has already been
+//! converted are instead resolved from the cached month with an epoch day offset.
+//!
+//! Months are cached per calendar data source, so calendars whose data was loaded from a data
+//! provider never share months with calendars using compiled data or another provider's data.
+
+use std::{
+    collections::{BTreeMap, VecDeque},
+    sync::{
+        atomic::{AtomicU64, Ordering},
+        Mutex, OnceLock, PoisonError,
+    },
+};
+
+use icu_calendar::{AnyCalendar, Calendar, Date as IcuDate, Ref};
+use tinystr::TinyAsciiStr;
+
+use super::CalendarDataSource;
+use crate::{iso::IsoDate, utils, TemporalResult};
+
+/// The default number of months held by the calendar month cache.
+pub const DEFAULT_CALENDAR_CACHE_CAPACITY: usize = 512;
+
+/// A snapshot of the calendar month cache's statistics.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct CalendarCacheStats {
+    /// The number of conversions resolved from a cached month.
+    pub hits: u64,
+    /// The number of conversions that required an astronomical calculation.
+    pub misses: u64,
+    /// The number of months currently cached.
+    pub len: usize,
+    /// The maximum number of months that may be cached.
+    pub capacity: usize,
+}
+
+/// Returns the current statistics of the calendar month cache.
+#[must_use]
+pub fn calendar_cache_stats() -> CalendarCacheStats {
+    let cache = month_cache();
+    let months = cache.lock();
+    CalendarCacheStats {
+        hits: cache.hits.load(Ordering::Relaxed),
+        misses: cache.misses.load(Ordering::Relaxed),
+        len: months.order.len(),
+        capacity: months.capacity,
+    }
+}
+
+/// Sets the maximum number of months held by the calendar month cache, evicting the oldest
+/// months if needed. A capacity of zero disables the cache.
+pub fn set_calendar_cache_capacity(capacity: usize) {
+    let mut months = month_cache().lock();
+    months.capacity = capacity;
+    months.evict();
+}
+
+/// Removes all months from the calendar month cache and resets its statistics.
+pub fn clear_calendar_cache() {
+    let cache = month_cache();
+    let mut months = cache.lock();
+    months.months.clear();
+    months.order.clear();
+    cache.hits.store(0, Ordering::Relaxed);
+    cache.misses.store(0, Ordering::Relaxed);
+}
+
+// ==== Internal cache ====
+
+/// The calendar fields of a single month of a builtin calendar.
+#[derive(Debug, Clone, Copy)]
+pub(crate) struct CalendarMonth {
+    /// The epoch day of the first day of the month.
+    start: i64,
+    /// The number of days in the month.
+    days: u8,
+    era: TinyAsciiStr<16>,
+    year: i32,
+    /// The ordinal month of the month in its year.
+    month: u8,
+    month_code: TinyAsciiStr<4>,
+}
+
+impl CalendarMonth {
+    fn contains(&self, epoch_days: i64) -> bool {
+        (self.start..self.start + i64::from(self.days)).contains(&epoch_days)
+    }
+}
+
+/// The builtin calendars whose months are cached.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, PartialOrd, Ord)]
+enum CachedCalendar {
+    Chinese,
+    Dangi,
+    IslamicObservational,
+    IslamicUmmAlQura,
+}
+
+impl CachedCalendar {
+    fn from_calendar(calendar: &AnyCalendar) -> Option<Self> {
+        match calendar {
+            AnyCalendar::Chinese(_) => Some(Self::Chinese),
+            AnyCalendar::Dangi(_) => Some(Self::Dangi),
+            AnyCalendar::IslamicObservational(_) => Some(Self::IslamicObservational),
+            AnyCalendar::IslamicUmmAlQura(_) => Some(Self::IslamicUmmAlQura),
+            _ => None,
+        }
+    }
+}
+
+/// The calendar, the source of its data, and the epoch day of the first day of a month.
+type MonthKey = (CachedCalendar, CalendarDataSource, i64);
+
+#[derive(Debug)]
+struct Months {
+    months: BTreeMap<MonthKey, CalendarMonth>,
+    /// The keys of `months` in insertion order.
+    order: VecDeque<MonthKey>,
+    capacity: usize,
+}
+
+impl Months {
+    fn get(
+        &self,
+        calendar: CachedCalendar,
+        data: CalendarDataSource,
+        epoch_days: i64,
+    ) -> Option<CalendarMonth> {
+        self.months
+            .range((calendar, data, i64::MIN)..=(calendar, data, epoch_days))
+            .next_back()
+            .map(|(_, month)| *month)
+            .filter(|month| month.contains(epoch_days))
+    }
+
+    fn insert(&mut self, calendar: CachedCalendar, data: CalendarDataSource, month: CalendarMonth) {
+        if self.capacity == 0 {
+            return;
+        }
+        let key = (calendar, data, month.start);
+        if self.months.insert(key, month).is_none() {
+            self.order.push_back(key);
+        }
+        self.evict();
+    }
+
+    fn evict(&mut self) {
+        while self.order.len() > self.capacity {
+            if let Some(key) = self.order.pop_front() {
+                self.months.remove(&key);
+            }
+        }
+    }
+}
+
+#[derive(Debug)]
+struct MonthCache {
+    months: Mutex<Months>,
+    hits: AtomicU64,
+    misses: AtomicU64,
+}
+
+impl MonthCache {
+    fn lock(&self) -> std::sync::MutexGuard<'_, Months> {
+        // NOTE: A panic while holding the lock cannot leave `Months` in an invalid state.
+        self.months.lock().unwrap_or_else(PoisonError::into_inner)
+    }
+}
+
+fn month_cache() -> &'static MonthCache {
+    static CACHE: OnceLock<MonthCache> = OnceLock::new();
+    CACHE.get_or_init(|| MonthCache {
+        months: Mutex::new(Months {
+            months: BTreeMap::new(),
+            order: VecDeque::new(),
+            capacity: DEFAULT_CALENDAR_CACHE_CAPACITY,
+        }),
+        hits: AtomicU64::new(0),
+        misses: AtomicU64::new(0),
+    })
+}
+
+/// A date of a builtin calendar.
+///
+/// Dates of the astronomical calendars are resolved from their cached month, so every field
+/// is a lookup or an epoch day offset. Dates of all other calendars are converted directly,
+/// and each field is only computed when it is requested.
+pub(crate) enum CalendarDate<'a> {
+    /// A date within a cached month, along with its epoch day.
+    Cached(CalendarMonth, i64),
+    /// A date of a calendar whose months are not cached.
+    Converted(IcuDate<Ref<'a, AnyCalendar>>),
+}
+
+impl CalendarDate<'_> {
+    pub(crate) fn era(&self) -> TinyAsciiStr<16> {
+        match self {
+            Self::Cached(month, _) => month.era,
+            Self::Converted(date) => date.year().era.0,
+        }
+    }
+
+    pub(crate) fn year(&self) -> i32 {
+        match self {
+            Self::Cached(month, _) => month.year,
+            Self::Converted(date) => date.year().number,
+        }
+    }
+
+    pub(crate) fn month(&self) -> u8 {
+        match self {
+            Self::Cached(month, _) => month.month,
+            // NOTE: Ordinal months of the builtin calendars are at most 14.
+            Self::Converted(date) => date.month().ordinal as u8,
+        }
+    }
+
+    pub(crate) fn month_code(&self) -> TinyAsciiStr<4> {
+        match self {
+            Self::Cached(month, _) => month.month_code,
+            Self::Converted(date) => date.month().code.0,
+        }
+    }
+
+    pub(crate) fn day(&self) -> u8 {
+        match self {
+            // NOTE: The epoch day is within the month, so the offset is less than its length.
+            Self::Cached(month, epoch_days) => (epoch_days - month.start + 1) as u8,
+            Self::Converted(date) => date.day_of_month().0 as u8,
+        }
+    }
+
+    pub(crate) fn days_in_month(&self) -> u8 {
+        match self {
+            Self::Cached(month, _) => month.days,
+            Self::Converted(date) => date.days_in_month(),
+        }
+    }
+}
+
+/// Returns the provided `IsoDate` as a date of the builtin calendar.
+///
+/// Months of the astronomical calendars are cached per data source; all other calendars are
+/// converted directly.
+pub(crate) fn calendar_date(
+    calendar: &AnyCalendar,
+    data: CalendarDataSource,
+    iso: IsoDate,
+) -> TemporalResult<CalendarDate<'_>> {
+    let Some(cached) = CachedCalendar::from_calendar(calendar) else {
+        return Ok(CalendarDate::Converted(IcuDate::new_from_iso(
+            iso.as_icu4x()?,
+            Ref(calendar),
+        )));
+    };
+
+    let epoch_days = utils::epoch_days_from_gregorian_date(iso.year, iso.month, iso.day);
+    let cache = month_cache();
+    if let Some(month) = cache.lock().get(cached, data, epoch_days) {
+        cache.hits.fetch_add(1, Ordering::Relaxed);
+        return Ok(CalendarDate::Cached(month, epoch_days));
+    }
+
+    // NOTE: The lock is not held during the conversion so that other threads are not blocked
+    // on an astronomical calculation.
+    cache.misses.fetch_add(1, Ordering::Relaxed);
+    let month = convert_month(calendar, iso, epoch_days)?;
+    cache.lock().insert(cached, data, month);
+    Ok(CalendarDate::Cached(month, epoch_days))
+}
+
+fn convert_month(
+    calendar: &AnyCalendar,
+    iso: IsoDate,
+    epoch_days: i64,
+) -> TemporalResult<CalendarMonth> {
+    let date = calendar.date_from_iso(iso.as_icu4x()?);
+    let year = calendar.year(&date);
+    let month = calendar.month(&date);
+    let day_of_month = calendar.day_of_month(&date).0;
+    Ok(CalendarMonth {
+        start: epoch_days - i64::from(day_of_month) + 1,
+        days: calendar.days_in_month(&date),
+        era: year.era.0,
+        year: year.number,
+        month: month.ordinal as u8,
+        month_code: month.code.0,
+    })
+}
+
+#[cfg(test)]
+mod tests {
+    use super::{CachedCalendar, CalendarDataSource, CalendarDate, CalendarMonth, Months};
+    use tinystr::tinystr;
+
+    const COMPILED: CalendarDataSource = CalendarDataSource::Compiled;
+
+    fn month(start: i64, days: u8) -> CalendarMonth {
+        CalendarMonth {
+            start,
+            days,
+            era: tinystr!(16, "test"),
+            year: 1,
+            month: 2,
+            month_code: tinystr!(4, "M02"),
+        }
+    }
+
+    #[test]
+    fn cached_date_fields() {
+        let date = CalendarDate::Cached(month(100, 30), 114);
+        assert_eq!(date.year(), 1);
+        assert_eq!((date.month(), date.month_code().as_str()), (2, "M02"));
+        assert_eq!((date.day(), date.days_in_month()), (15, 30));
+        assert_eq!(CalendarDate::Cached(month(100, 30), 129).day(), 30);
+    }
+
+    #[test]
+    fn months_lookup_and_eviction() {
+        let mut months = Months {
+            months: Default::default(),
+            order: Default::default(),
+            capacity: 2,
+        };
+        months.insert(CachedCalendar::Chinese, COMPILED, month(0, 29));
+        months.insert(CachedCalendar::Chinese, COMPILED, month(29, 30));
+
+        assert_eq!(
+            months
+                .get(CachedCalendar::Chinese, COMPILED, 0)
+                .map(|m| m.start),
+            Some(0)
+        );
+        assert_eq!(
+            months
+                .get(CachedCalendar::Chinese, COMPILED, 28)
+                .map(|m| m.start),
+            Some(0)
+        );
+        assert_eq!(
+            months
+                .get(CachedCalendar::Chinese, COMPILED, 58)
+                .map(|m| m.start),
+            Some(29)
+        );
+        assert!(months.get(CachedCalendar::Chinese, COMPILED, 59).is_none());
+        assert!(months.get(CachedCalendar::Chinese, COMPILED, -1).is_none());
+        assert!(months.get(CachedCalendar::Dangi, COMPILED, 10).is_none());
+
+        // The oldest month is evicted once the capacity is exceeded.
+        months.insert(CachedCalendar::Dangi, COMPILED, month(0, 29));
+        assert!(months.get(CachedCalendar::Chinese, COMPILED, 10).is_none());
+        assert!(months.get(CachedCalendar::Chinese, COMPILED, 40).is_some());
+        assert!(months.get(CachedCalendar::Dangi, COMPILED, 10).is_some());
+
+        // Months are not shared with a calendar loaded from a data provider.
+        months.capacity = 4;
+        let provider = CalendarDataSource::Provider(0);
+        assert!(months.get(CachedCalendar::Chinese, provider, 40).is_none());
+        months.insert(CachedCalendar::Chinese, provider, month(29, 30));
+        assert!(months.get(CachedCalendar::Chinese, provider, 40).is_some());
+        assert!(months.get(CachedCalendar::Chinese, COMPILED, 40).is_some());
+        assert_eq!(months.order.len(), 3);
+        assert!(months
+            .get(CachedCalendar::Chinese, CalendarDataSource::Provider(1), 40)
+            .is_none());
+
+        months.capacity = 0;
+        months.evict();
+        assert!(months.months.is_empty());
+        months.insert(CachedCalendar::Dangi, COMPILED, month(0, 29));
+        assert!(months.months.is_empty());
+    }
+}
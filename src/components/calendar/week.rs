@@ -0,0 +1,224 @@
+//! This module implements pre-resolved week rules for week of year calculations.
+
+use crate::{iso::IsoDateSlots, utils, TemporalError, TemporalResult};
+
+/// The week of a year along with the year that the week belongs to.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct WeekOf {
+    /// The 1-based week of `year`.
+    pub week: u16,
+    /// The year that the week belongs to, which may differ from the date's year.
+    pub year: i32,
+}
+
+/// Pre-resolved rules for calculating the week of a year.
+///
+/// Weeks begin on `first_weekday`, and the first week of a year is the first week that
+/// contains at least `min_week_days` days of that year. A `WeekRules` is cheap to copy and
+/// can be resolved once and shared across threads.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub struct WeekRules {
+    first_weekday: u8,
+    min_week_days: u8,
+}
+
+impl Default for WeekRules {
+    fn default() -> Self {
+        Self::ISO
+    }
+}
+
+impl WeekRules {
+    /// The ISO 8601 week rules, where weeks begin on Monday and the first week of a year
+    /// contains at least four days of that year.
+    pub const ISO: Self = Self {
+        first_weekday: 1,
+        min_week_days: 4,
+    };
+
+    /// Creates new `WeekRules`.
+    ///
+    /// `first_weekday` is the ISO day of the week that a week begins on, from 1 (Monday) to 7
+    /// (Sunday). `min_week_days` is the minimum number of days of a year in its first week,
+    /// from 1 to 7.
+    pub fn new(first_weekday: u8, min_week_days: u8) -> TemporalResult<Self> {
+        if !(1..=7).contains(&first_weekday) || !(1..=7).contains(&min_week_days) {
+            return Err(TemporalError::range().with_message("Invalid week rules."));
+        }
+        Ok(Self {
+            first_weekday,
+            min_week_days,
+        })
+    }
+
+    /// Returns the ISO day of the week that a week begins on.
+    #[inline]
+    #[must_use]
+    pub const fn first_weekday(&self) -> u8 {
+        self.first_weekday
+    }
+
+    /// Returns the minimum number of days of a year in its first week.
+    #[inline]
+    #[must_use]
+    pub const fn min_week_days(&self) -> u8 {
+        self.min_week_days
+    }
+
+    /// Returns the week of year for the ISO date of the provided value.
+    #[inline]
+    #[must_use]
+    pub fn week_of<T: IsoDateSlots>(&self, date: &T) -> WeekOf {
+        let iso = date.iso_date();
+        self.week_of_iso_date(iso.year, iso.month, iso.day)
+    }
+
+    /// Returns the week of year for the provided ISO date.
+    pub(crate) fn week_of_iso_date(&self, year: i32, month: u8, day: u8) -> WeekOf {
+        let epoch_days = utils::epoch_days_from_gregorian_date(year, month, day);
+        // The 0-based day of the year.
+        let day_of_year = epoch_days - utils::epoch_days_from_gregorian_date(year, 1, 1);
+        let first_week_start = self.first_week_start(year);
+
+        // The date is in the final week of the previous year.
+        if day_of_year < first_week_start {
+            let days_in_previous_year = days_in_year(year - 1);
+            let week =
+                (day_of_year + days_in_previous_year - self.first_week_start(year - 1)) / 7 + 1;
+            return WeekOf {
+                week: week as u16,
+                year: year - 1,
+            };
+        }
+
+        // The date may be in the first week of the next year.
+        if day_of_year >= days_in_year(year) + self.first_week_start(year + 1) {
+            return WeekOf {
+                week: 1,
+                year: year + 1,
+            };
+        }
+
+        WeekOf {
+            week: ((day_of_year - first_week_start) / 7 + 1) as u16,
+            year,
+        }
+    }
+
+    /// Returns the 0-based day of the year that the first week of `year` begins on. The
+    /// value is negative when the first week begins in the previous year.
+    fn first_week_start(&self, year: i32) -> i64 {
+        let days = utils::epoch_days_from_gregorian_date(year, 1, 1);
+        // NOTE: 1970-01-01 was a Thursday, which is ISO day of the week 4.
+        let weekday = (days + 3).rem_euclid(7) + 1;
+        // The position of January 1st in its week.
+        let offset = (weekday - i64::from(self.first_weekday)).rem_euclid(7);
+        if 7 - offset >= i64::from(self.min_week_days) {
+            -offset
+        } else {
+            7 - offset
+        }
+    }
+}
+
+#[inline]
+fn days_in_year(year: i32) -> i64 {
+    if utils::is_gregorian_leap_year(year) {
+        366
+    } else {
+        365
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::{WeekOf, WeekRules};
+
+    #[test]
+    fn iso_week_of_year() {
+        let iso = WeekRules::ISO;
+        let cases = [
+            ((2021, 1, 3), (53, 2020)),
+            ((2021, 1, 4), (1, 2021)),
+            ((2019, 12, 30), (1, 2020)),
+            ((2020, 12, 31), (53, 2020)),
+            ((2024, 12, 30), (1, 2025)),
+            ((2023, 1, 1), (52, 2022)),
+            ((2023, 6, 15), (24, 2023)),
+            ((-271_821, 4, 20), (16, -271_821)),
+        ];
+        for ((y, m, d), (week, year)) in cases {
+            assert_eq!(
+                iso.week_of_iso_date(y, m, d),
+                WeekOf { week, year },
+                "{y}-{m}-{d}"
+            );
+        }
+    }
+
+    #[test]
+    fn custom_week_rules() {
+        // Weeks begin on Sunday and the first week contains January 1st.
+        let us = WeekRules::new(7, 1).unwrap();
+        assert_eq!(
+            us.week_of_iso_date(2020, 12, 31),
+            WeekOf {
+                week: 1,
+                year: 2021
+            }
+        );
+        assert_eq!(
+            us.week_of_iso_date(2020, 12, 26),
+            WeekOf {
+                week: 52,
+                year: 2020
+            }
+        );
+        assert_eq!(
+            us.week_of_iso_date(2021, 1, 3),
+            WeekOf {
+                week: 2,
+                year: 2021
+            }
+        );
+
+        assert!(WeekRules::new(0, 4).is_err());
+        assert!(WeekRules::new(1, 8).is_err());
+    }
+
+    #[test]
+    fn weeks_are_contiguous() {
+        // Every week holds exactly seven consecutive days for all rules.
+        for first_weekday in 1..=7 {
+            for min_week_days in 1..=7 {
+                let rules = WeekRules::new(first_weekday, min_week_days).unwrap();
+                let mut previous = rules.week_of_iso_date(1999, 1, 1);
+                let mut run = 0;
+                for year in 1999..=2030 {
+                    for month in 1..=12 {
+                        for day in 1..=crate::utils::gregorian_days_in_month(year, month) {
+                            let current = rules.week_of_iso_date(year, month, day);
+                            if current == previous {
+                                run += 1;
+                                continue;
+                            }
+                            if year > 1999 {
+                                assert_eq!(run, 7);
+                            }
+                            let expected_next = if current.year == previous.year {
+                                previous.week + 1
+                            } else {
+                                1
+                            };
+                            if year > 1999 {
+                                assert_eq!(current.week, expected_next);
+                            }
+                            previous = current;
+                            run = 1;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
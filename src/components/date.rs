@@ -13,7 +13,7 @@ use crate::{
         ArithmeticOverflow, RelativeTo, RoundingIncrement, TemporalRoundingMode, TemporalUnit,
     },
     parsers::parse_date_time,
-    TemporalError, TemporalFields, TemporalResult, TemporalUnwrap,
+    DateFields, TemporalError, TemporalFields, TemporalResult, TemporalUnwrap,
 };
 use std::str::FromStr;
 
@@ -37,7 +37,7 @@ impl<C: CalendarProtocol> Date<C> {
     /// Create a new `Date` with the date values and calendar slot.
     #[inline]
     #[must_use]
-    pub(crate) fn new_unchecked(iso: IsoDate, calendar: CalendarSlot<C>) -> Self {
+    pub(crate) const fn new_unchecked(iso: IsoDate, calendar: CalendarSlot<C>) -> Self {
         Self { iso, calendar }
     }
 
@@ -235,6 +235,17 @@ impl<C: CalendarProtocol> Date<C> {
 // ==== Public API ====
 
 impl<C: CalendarProtocol> Date<C> {
+    /// Creates a new ISO 8601 `Date` in a const context, returning `None` if the date is not
+    /// valid or not within valid limits.
+    #[inline]
+    #[must_use]
+    pub const fn try_new_iso(year: i32, month: u8, day: u8) -> Option<Self> {
+        match IsoDate::try_new(year, month, day) {
+            Some(iso) => Some(Self::new_unchecked(iso, CalendarSlot::iso())),
+            None => None,
+        }
+    }
+
     /// Creates a new `Date` while checking for validity.
     pub fn new(
         year: i32,
@@ -658,7 +669,62 @@ impl<C: CalendarProtocol> IsoDateSlots for Date<C> {
 
 // ==== Context based API ====
 
-impl<C: CalendarProtocol> Date<C> {}
+impl<C: CalendarProtocol> Date<C> {
+    /// Creates a `Date` from typed `DateFields` and a calendar, i.e. `Temporal.PlainDate.from`
+    /// with a property bag.
+    ///
+    /// The `overflow` defaults to "constrain".
+    pub fn from_fields(
+        fields: &DateFields,
+        calendar: CalendarSlot<C>,
+        overflow: Option<ArithmeticOverflow>,
+        context: &mut C::Context,
+    ) -> TemporalResult<Self> {
+        calendar.date_from_date_fields(
+            fields,
+            overflow.unwrap_or(ArithmeticOverflow::Constrain),
+            context,
+        )
+    }
+
+    /// Creates a new `Date` with the provided fields replaced.
+    ///
+    /// An ISO 8601 `Date` is updated in place, while other calendars merge the fields with
+    /// the current calendar fields and resolve them in a single `dateFromFields`. The
+    /// `overflow` defaults to "constrain".
+    ///
+    /// Equivalent: `Temporal.PlainDate.prototype.with`
+    pub fn with(
+        &self,
+        fields: &DateFields,
+        overflow: Option<ArithmeticOverflow>,
+        context: &mut C::Context,
+    ) -> TemporalResult<Self> {
+        if fields.is_empty() {
+            return Err(TemporalError::r#type().with_message("No fields were provided to with."));
+        }
+        fields.validate_positive()?;
+        let overflow = overflow.unwrap_or(ArithmeticOverflow::Constrain);
+
+        if self.calendar.is_iso() {
+            let month = if fields.month.is_some() || fields.month_code.is_some() {
+                Some(fields.iso_month()?)
+            } else {
+                None
+            };
+            let iso = self.iso.with(fields.year, month, fields.day, overflow)?;
+            return Ok(Self::new_unchecked(iso, self.calendar.clone()));
+        }
+
+        let date_like = CalendarDateLike::Date(self.clone());
+        let current = DateFields::new()
+            .with_year(self.calendar.year(&date_like, context)?)
+            .with_month_code(self.calendar.month_code(&date_like, context)?)
+            .with_day(self.calendar.day(&date_like, context)?.into());
+        self.calendar
+            .date_from_date_fields(&current.merge(fields), overflow, context)
+    }
+}
 
 // ==== Trait impls ====
 
@@ -687,6 +753,7 @@ impl<C: CalendarProtocol> FromStr for Date<C> {
 #[cfg(test)]
 mod tests {
     use super::*;
+    use crate::error::ErrorKind;
 
     #[test]
     fn simple_date_add() {
@@ -786,6 +853,34 @@ mod tests {
         assert_eq!(result.days(), 9719.0,);
     }
 
+    #[test]
+    fn date_until_negative_weeks() {
+        let earlier = Date::<()>::from_str("2024-01-01").unwrap();
+        let later = Date::<()>::from_str("2024-01-20").unwrap();
+        let result = later
+            .until(&earlier, None, None, None, Some(TemporalUnit::Week))
+            .unwrap();
+        assert_eq!(result.weeks(), -2.0);
+        assert_eq!(result.days(), -5.0);
+    }
+
+    #[test]
+    fn date_until_months_across_full_range() {
+        let earliest = Date::<()>::from_str("-271821-04-20").unwrap();
+        let latest = Date::<()>::from_str("+275760-09-13").unwrap();
+        let result = earliest
+            .until(&latest, None, None, None, Some(TemporalUnit::Month))
+            .unwrap();
+        assert_eq!(result.months(), 6_570_976.0);
+        assert_eq!(result.days(), 24.0);
+
+        let result = latest
+            .until(&earliest, None, None, None, Some(TemporalUnit::Month))
+            .unwrap();
+        assert_eq!(result.months(), -6_570_976.0);
+        assert_eq!(result.days(), -23.0);
+    }
+
     #[test]
     fn simple_date_since() {
         let earlier = Date::<()>::from_str("1969-07-24").unwrap();
@@ -863,4 +958,130 @@ mod tests {
             assert!(Date::<()>::from_str(s).is_err())
         }
     }
+
+    #[test]
+    fn date_from_fields() {
+        let calendar = CalendarSlot::<()>::default();
+        let fields = DateFields::new().with_year(2024).with_day(31);
+
+        // The typed fields resolve to the same date as `TemporalFields`.
+        let typed = Date::from_fields(
+            &fields.with_month_code("M02".parse().unwrap()),
+            calendar.clone(),
+            None,
+            &mut (),
+        )
+        .unwrap();
+        let mut temporal_fields = TemporalFields::from(fields.with_month(2));
+        let untyped = calendar
+            .date_from_fields(&mut temporal_fields, ArithmeticOverflow::Constrain, &mut ())
+            .unwrap();
+        assert_eq!(typed.iso, untyped.iso);
+        assert_eq!(typed.iso, IsoDate::new_unchecked(2024, 2, 29));
+
+        assert!(Date::from_fields(
+            &fields.with_month(2),
+            calendar.clone(),
+            Some(ArithmeticOverflow::Reject),
+            &mut ()
+        )
+        .is_err());
+        // "M13" is not a valid ISO 8601 month code.
+        assert!(Date::from_fields(
+            &fields.with_month_code("M13".parse().unwrap()),
+            calendar.clone(),
+            None,
+            &mut ()
+        )
+        .is_err());
+        assert!(Date::from_fields(
+            &fields.with_month(1).with_month_code("M02".parse().unwrap()),
+            calendar.clone(),
+            None,
+            &mut ()
+        )
+        .is_err());
+        assert!(Date::from_fields(&fields, calendar.clone(), None, &mut ()).is_err());
+        assert!(Date::from_fields(
+            &DateFields::new().with_month(1).with_day(1),
+            calendar.clone(),
+            None,
+            &mut ()
+        )
+        .is_err());
+
+        // A month or day below one is a RangeError rather than constrained.
+        for fields in [
+            fields.with_month(0),
+            DateFields::new().with_year(2024).with_month(1).with_day(-3),
+            DateFields::new().with_year(2024).with_month(0).with_day(-3),
+        ] {
+            let err = Date::from_fields(&fields, calendar.clone(), None, &mut ()).unwrap_err();
+            assert_eq!(err.kind(), ErrorKind::Range);
+        }
+    }
+
+    #[test]
+    fn date_with() {
+        let base = Date::<()>::new(
+            2024,
+            1,
+            31,
+            CalendarSlot::default(),
+            ArithmeticOverflow::Reject,
+        )
+        .unwrap();
+        let with = |fields: DateFields, overflow| base.with(&fields, Some(overflow), &mut ());
+
+        let constrained = with(
+            DateFields::new().with_month(2),
+            ArithmeticOverflow::Constrain,
+        )
+        .unwrap();
+        assert_eq!(constrained.iso, IsoDate::new_unchecked(2024, 2, 29));
+        assert!(with(DateFields::new().with_month(2), ArithmeticOverflow::Reject).is_err());
+
+        let month_code = "M04".parse().unwrap();
+        let replaced = with(
+            DateFields::new()
+                .with_year(2023)
+                .with_month_code(month_code)
+                .with_day(30),
+            ArithmeticOverflow::Reject,
+        );
+        assert_eq!(replaced.unwrap().iso, IsoDate::new_unchecked(2023, 4, 30));
+        assert!(with(DateFields::new().with_day(32), ArithmeticOverflow::Reject).is_err());
+        assert!(with(
+            DateFields::new().with_year(275_761),
+            ArithmeticOverflow::Constrain
+        )
+        .is_err());
+        assert!(with(DateFields::new(), ArithmeticOverflow::Constrain).is_err());
+
+        // A month or day below one is rejected with either overflow.
+        for overflow in [ArithmeticOverflow::Constrain, ArithmeticOverflow::Reject] {
+            for fields in [
+                DateFields::new().with_month(0),
+                DateFields::new().with_month(-1),
+                DateFields::new().with_day(0),
+                DateFields::new().with_year(2023).with_day(-5),
+            ] {
+                let err = with(fields, overflow).unwrap_err();
+                assert_eq!(err.kind(), ErrorKind::Range);
+            }
+        }
+
+        // The result matches `merge_fields` followed by `date_from_fields`.
+        let calendar = base.calendar();
+        let mut merged = TemporalFields::from(base.iso)
+            .merge_fields(
+                &TemporalFields::from(DateFields::new().with_month(2)),
+                calendar,
+            )
+            .unwrap();
+        let expected = calendar
+            .date_from_fields(&mut merged, ArithmeticOverflow::Constrain, &mut ())
+            .unwrap();
+        assert_eq!(constrained.iso, expected.iso);
+    }
 }
@@ -6,25 +6,30 @@ use crate::{
         Instant,
     },
     iso::{IsoDate, IsoDateSlots, IsoDateTime, IsoTime},
-    options::ArithmeticOverflow,
+    options::{
+        ArithmeticOverflow, RelativeTo, RoundingIncrement, TemporalRoundingMode, TemporalUnit,
+    },
     parsers::parse_date_time,
-    TemporalError, TemporalResult, TemporalUnwrap,
+    rounding::{IncrementRounder, Round},
+    utils, DateFields, TemporalError, TemporalResult, TemporalUnwrap, TimeFields, NS_PER_DAY,
 };
 
-use std::str::FromStr;
+use std::{cmp::Ordering, num::NonZeroU64, str::FromStr};
 use tinystr::TinyAsciiStr;
 
 use super::{
     calendar::{CalendarDateLike, GetCalendarSlot},
-    duration::normalized::NormalizedTimeDuration,
-    Duration,
+    duration::{normalized::NormalizedTimeDuration, DateDuration, TimeDuration},
+    Date, Duration, Time,
 };
 
+const NS_PER_DAY_128BIT: i128 = NS_PER_DAY as i128;
+
 /// The native Rust implementation of `Temporal.PlainDateTime`
 #[non_exhaustive]
 #[derive(Debug, Default, Clone)]
 pub struct DateTime<C: CalendarProtocol> {
-    iso: IsoDateTime,
+    pub(crate) iso: IsoDateTime,
     calendar: CalendarSlot<C>,
 }
 
@@ -34,7 +39,7 @@ impl<C: CalendarProtocol> DateTime<C> {
     /// Creates a new unchecked `DateTime`.
     #[inline]
     #[must_use]
-    pub(crate) fn new_unchecked(iso: IsoDateTime, calendar: CalendarSlot<C>) -> Self {
+    pub(crate) const fn new_unchecked(iso: IsoDateTime, calendar: CalendarSlot<C>) -> Self {
         Self { iso, calendar }
     }
 
@@ -72,6 +77,25 @@ impl<C: CalendarProtocol> DateTime<C> {
         // 5. Let norm be NormalizeTimeDuration(sign × duration.[[Hours]], sign × duration.[[Minutes]], sign × duration.[[Seconds]], sign × duration.[[Milliseconds]], sign × duration.[[Microseconds]], sign × duration.[[Nanoseconds]]).
         let norm = NormalizedTimeDuration::from_time_duration(duration.time());
 
+        // NOTE: `AddDate` only calls into the calendar when years, months, or weeks are
+        // present, so durations of days and time are added to the epoch nanoseconds directly.
+        let date = duration.date();
+        if date.years == 0.0 && date.months == 0.0 && date.weeks == 0.0 {
+            // NOTE: `as` saturates for days beyond the range of an i128, so the checked
+            // operations below reject any day count that could not produce a valid result.
+            if !date.days.is_finite() {
+                return Err(TemporalError::range().with_message("Duration days must be finite."));
+            }
+            let nanos = (date.days as i128)
+                .checked_mul(NS_PER_DAY_128BIT)
+                .and_then(|nanos| nanos.checked_add(norm.0))
+                .ok_or_else(|| {
+                    TemporalError::range().with_message("DateTime addition is out of range.")
+                })?;
+            let result = self.iso.add_nanoseconds(nanos)?;
+            return Ok(Self::new_unchecked(result, self.calendar.clone()));
+        }
+
         // TODO: validate Constrain is default with all the recent changes.
         // 6. Let result be ? AddDateTime(dateTime.[[ISOYear]], dateTime.[[ISOMonth]], dateTime.[[ISODay]], dateTime.[[ISOHour]], dateTime.[[ISOMinute]], dateTime.[[ISOSecond]], dateTime.[[ISOMillisecond]], dateTime.[[ISOMicrosecond]], dateTime.[[ISONanosecond]], calendarRec, sign × duration.[[Years]], sign × duration.[[Months]], sign × duration.[[Weeks]], sign × duration.[[Days]], norm, options).
         let result = self.iso.add_date_duration(
@@ -89,6 +113,211 @@ impl<C: CalendarProtocol> DateTime<C> {
         // 9. Return ? CreateTemporalDateTime(result.[[Year]], result.[[Month]], result.[[Day]], result.[[Hour]], result.[[Minute]], result.[[Second]], result.[[Millisecond]], result.[[Microsecond]], result.[[Nanosecond]], dateTime.[[Calendar]]).
         Ok(Self::new_unchecked(result, self.calendar.clone()))
     }
+
+    /// Returns the date and normalized time difference from this `DateTime` to `other`.
+    ///
+    /// Equivalent: 5.5.11 `DifferenceISODateTime`
+    fn diff_date_time(
+        &self,
+        other: &Self,
+        largest_unit: TemporalUnit,
+        context: &mut C::Context,
+    ) -> TemporalResult<(DateDuration, NormalizedTimeDuration)> {
+        // 1. Assert: ISODateTimeWithinLimits(y1, mon1, d1, h1, min1, s1, ms1, mus1, ns1) is true.
+        // 2. Assert: ISODateTimeWithinLimits(y2, mon2, d2, h2, min2, s2, ms2, mus2, ns2) is true.
+        // 3. Let timeDuration be DifferenceTime(h1, min1, s1, ms1, mus1, ns1, h2, min2, s2, ms2, mus2, ns2).
+        let mut time = other.iso.time.as_nanoseconds() - self.iso.time.as_nanoseconds();
+        // 4. Let timeSign be NormalizedTimeDurationSign(timeDuration).
+        let time_sign = time.signum();
+        // 5. Let dateSign be CompareISODate(y2, mon2, d2, y1, mon1, d1).
+        let date_sign = other.iso.date.cmp(&self.iso.date) as i128;
+        // 6. Let adjustedDate be CreateISODateRecord(y2, mon2, d2).
+        let mut adjusted_date = other.iso.date;
+        // 7. If timeSign = -dateSign, then
+        if time_sign != 0 && time_sign == -date_sign {
+            // a. Set adjustedDate to BalanceISODate(adjustedDate.[[Year]], adjustedDate.[[Month]], adjustedDate.[[Day]] + timeSign).
+            let epoch_days = utils::epoch_days_from_gregorian_date(
+                adjusted_date.year,
+                adjusted_date.month,
+                adjusted_date.day,
+            );
+            let (year, month, day) =
+                utils::gregorian_date_from_epoch_days(epoch_days + time_sign as i64);
+            adjusted_date = IsoDate::new_unchecked(year, month, day);
+            // b. Set timeDuration to ? Add24HourDaysToNormalizedTimeDuration(timeDuration, -timeSign).
+            time -= time_sign * NS_PER_DAY_128BIT;
+        }
+
+        // 8. Let date1 be ! CreateTemporalDate(y1, mon1, d1, calendarRec.[[Receiver]]).
+        let start = Date::new_unchecked(self.iso.date, self.calendar.clone());
+        // 9. Let date2 be ! CreateTemporalDate(adjustedDate.[[Year]], adjustedDate.[[Month]], adjustedDate.[[Day]], calendarRec.[[Receiver]]).
+        let end = Date::new_unchecked(adjusted_date, self.calendar.clone());
+        // 10. Let dateLargestUnit be LargerOfTwoTemporalUnits("day", largestUnit).
+        let date_largest_unit = largest_unit.max(TemporalUnit::Day);
+        // 11. Let untilOptions be OrdinaryObjectCreate(null).
+        // 12. Perform ! CreateDataPropertyOrThrow(untilOptions, "largestUnit", dateLargestUnit).
+        // 13. Let dateDifference be ? DifferenceDate(calendarRec, date1, date2, untilOptions).
+        let mut date = *start
+            .internal_diff_date(&end, date_largest_unit, context)?
+            .date();
+
+        // 14. Let days be dateDifference.[[Days]].
+        // 15. If largestUnit is not dateLargestUnit, then
+        if largest_unit != date_largest_unit {
+            // a. Set timeDuration to ? Add24HourDaysToNormalizedTimeDuration(timeDuration, days).
+            time += date.days as i128 * NS_PER_DAY_128BIT;
+            // b. Set days to 0.
+            date.days = 0.0;
+        }
+
+        // 16. Return ? CreateNormalizedDurationRecord(dateDifference.[[Years]], dateDifference.[[Months]], dateDifference.[[Weeks]], days, timeDuration).
+        Ok((date, NormalizedTimeDuration(time)))
+    }
+
+    /// Equivalent: `DifferenceTemporalPlainDateTime`
+    #[allow(clippy::too_many_arguments)]
+    fn diff(
+        &self,
+        op: bool,
+        other: &Self,
+        rounding_mode: Option<TemporalRoundingMode>,
+        rounding_increment: Option<RoundingIncrement>,
+        largest_unit: Option<TemporalUnit>,
+        smallest_unit: Option<TemporalUnit>,
+        context: &mut C::Context,
+    ) -> TemporalResult<Duration> {
+        // 1. If operation is SINCE, let sign be -1. Otherwise, let sign be 1.
+        // 2. Set other to ? ToTemporalDateTime(other).
+
+        // 3. If ? CalendarEquals(dateTime.[[Calendar]], other.[[Calendar]]) is false, throw a RangeError exception.
+        if self.calendar.identifier(context)? != other.calendar.identifier(context)? {
+            return Err(TemporalError::range()
+                .with_message("Calendars for the difference operation are not the same."));
+        }
+
+        // 4. Let resolvedOptions be ? SnapshotOwnProperties(? GetOptionsObject(options), null).
+        // 5. Let settings be ? GetDifferenceSettings(operation, resolvedOptions, DATETIME, « », "nanosecond", "day").
+        let rounding_increment = rounding_increment.unwrap_or_default();
+        let (sign, rounding_mode) = if op {
+            (
+                -1.0,
+                rounding_mode
+                    .unwrap_or(TemporalRoundingMode::Trunc)
+                    .negate(),
+            )
+        } else {
+            (1.0, rounding_mode.unwrap_or(TemporalRoundingMode::Trunc))
+        };
+        let smallest_unit = smallest_unit.unwrap_or(TemporalUnit::Nanosecond);
+        // Use the defaultlargestunit which is max smallestlargestdefault and smallestunit
+        let largest_unit = match largest_unit {
+            Some(TemporalUnit::Auto) | None => smallest_unit.max(TemporalUnit::Day),
+            Some(unit) => unit,
+        };
+        if smallest_unit == TemporalUnit::Auto || largest_unit < smallest_unit {
+            return Err(TemporalError::range()
+                .with_message("largestUnit must be larger than or equal to smallestUnit."));
+        }
+        if let Some(max) = smallest_unit.to_maximum_rounding_increment() {
+            rounding_increment.validate(u64::from(max), false)?;
+        }
+
+        // 6. If dateTime.[[ISOYear]] = other.[[ISOYear]], and dateTime.[[ISOMonth]] = other.[[ISOMonth]],
+        // and dateTime.[[ISODay]] = other.[[ISODay]], and dateTime.[[ISOHour]] = other.[[ISOHour]], ...,
+        // and dateTime.[[ISONanosecond]] = other.[[ISONanosecond]], then
+        if self.compare(other) == Ordering::Equal {
+            // a. Return ! CreateTemporalDuration(0, 0, 0, 0, 0, 0, 0, 0, 0, 0).
+            return Ok(Duration::default());
+        }
+
+        // 7. Let calendarRec be ? CreateCalendarMethodsRecord(dateTime.[[Calendar]], « DATE-ADD, DATE-UNTIL »).
+        // 8. Let diff be ? DifferenceISODateTime(dateTime.[[ISOYear]], ..., other.[[ISONanosecond]], calendarRec, settings.[[LargestUnit]], resolvedOptions).
+        let (mut date, mut norm) = self.diff_date_time(other, largest_unit, context)?;
+
+        // 9. If settings.[[SmallestUnit]] is "nanosecond" and settings.[[RoundingIncrement]] = 1,
+        // let roundingGranularityIsNoop be true; else let roundingGranularityIsNoop be false.
+        let is_noop = smallest_unit == TemporalUnit::Nanosecond
+            && rounding_increment == RoundingIncrement::ONE;
+
+        // 10. If roundingGranularityIsNoop is false, then
+        if !is_noop {
+            let start = || Date::new_unchecked(self.iso.date, self.calendar.clone());
+            match smallest_unit.as_nanoseconds() {
+                // NOTE: Time units are rounded directly on the normalized time, which is less than
+                // a day whenever the date difference is non-zero.
+                Some(unit_ns) => {
+                    let increment = NonZeroU64::new(unit_ns)
+                        .and_then(|ns| ns.checked_mul(rounding_increment.as_extended_increment()))
+                        .temporal_unwrap()?;
+                    norm = norm.round(increment, rounding_mode)?;
+                    // Rounding may carry the time into the next day, which is then balanced
+                    // into the date difference.
+                    if largest_unit >= TemporalUnit::Day && norm.0.abs() >= NS_PER_DAY_128BIT {
+                        let carry = norm.0.signum();
+                        date.days += carry as f64;
+                        norm = NormalizedTimeDuration(norm.0 - carry * NS_PER_DAY_128BIT);
+                        if largest_unit > TemporalUnit::Day {
+                            date = date.balance_relative(
+                                largest_unit,
+                                TemporalUnit::Day,
+                                Some(&start()),
+                                context,
+                            )?;
+                        }
+                    }
+                }
+                None => {
+                    // a. Let roundRecord be ? RoundDuration(diff.[[Years]], diff.[[Months]], diff.[[Weeks]], diff.[[Days]], diff.[[NormalizedTime]],
+                    // settings.[[RoundingIncrement]], settings.[[SmallestUnit]], settings.[[RoundingMode]], dateTime, calendarRec).
+                    let duration = Duration::new_unchecked(
+                        date,
+                        TimeDuration::from_normalized(norm, TemporalUnit::Hour)?.1,
+                    );
+                    let start = start();
+                    let round_record = duration.round_internal(
+                        rounding_increment,
+                        smallest_unit,
+                        rounding_mode,
+                        &RelativeTo::<C, ()> {
+                            zdt: None,
+                            date: Some(&start),
+                        },
+                        None,
+                        context,
+                    )?;
+                    // b. Let roundResult be roundRecord.[[NormalizedDuration]].
+                    // c. Set diff to ? BalanceDateDurationRelative(roundResult.[[Years]], roundResult.[[Months]], roundResult.[[Weeks]],
+                    // roundResult.[[Days]], settings.[[LargestUnit]], settings.[[SmallestUnit]], dateTime, calendarRec).
+                    date = round_record.0 .0 .0.balance_relative(
+                        largest_unit,
+                        smallest_unit,
+                        Some(&start),
+                        context,
+                    )?;
+                    norm = NormalizedTimeDuration::default();
+                }
+            }
+        }
+
+        // 11. Let result be ? BalanceTimeDuration(diff.[[NormalizedTime]], settings.[[LargestUnit]]).
+        let time = TimeDuration::from_normalized(norm, largest_unit.min(TemporalUnit::Hour))?.1;
+
+        // 12. Return ? CreateTemporalDuration(sign × diff.[[Years]], sign × diff.[[Months]], sign × diff.[[Weeks]], sign × diff.[[Days]],
+        // sign × result.[[Hours]], sign × result.[[Minutes]], sign × result.[[Seconds]], sign × result.[[Milliseconds]],
+        // sign × result.[[Microseconds]], sign × result.[[Nanoseconds]]).
+        Duration::new(
+            sign * date.years,
+            sign * date.months,
+            sign * date.weeks,
+            sign * date.days,
+            sign * time.hours,
+            sign * time.minutes,
+            sign * time.seconds,
+            sign * time.milliseconds,
+            sign * time.microseconds,
+            sign * time.nanoseconds,
+        )
+    }
 }
 
 // ==== Public DateTime API ====
@@ -125,6 +354,30 @@ impl<C: CalendarProtocol> DateTime<C> {
         ))
     }
 
+    /// Creates a new ISO 8601 `DateTime` in a const context, returning `None` if the date or
+    /// time is not valid or the `DateTime` is not within valid limits.
+    #[inline]
+    #[must_use]
+    #[allow(clippy::too_many_arguments)]
+    pub const fn try_new_iso(
+        year: i32,
+        month: u8,
+        day: u8,
+        hour: u8,
+        minute: u8,
+        second: u8,
+        millisecond: u16,
+        microsecond: u16,
+        nanosecond: u16,
+    ) -> Option<Self> {
+        let time =
+            IsoTime::new_unchecked(hour, minute, second, millisecond, microsecond, nanosecond);
+        match IsoDateTime::try_new(IsoDate::new_unchecked(year, month, day), time) {
+            Some(iso) => Some(Self::new_unchecked(iso, CalendarSlot::iso())),
+            None => None,
+        }
+    }
+
     /// Validates whether ISO date slots are within iso limits at noon.
     #[inline]
     pub fn validate<T: IsoDateSlots>(target: &T) -> bool {
@@ -200,6 +453,113 @@ impl<C: CalendarProtocol> DateTime<C> {
     pub fn calendar(&self) -> &CalendarSlot<C> {
         &self.calendar
     }
+
+    /// Compares the ISO date and time of this `DateTime` with `other`. The calendars are
+    /// not compared.
+    ///
+    /// Equivalent: `Temporal.PlainDateTime.compare`
+    #[inline]
+    #[must_use]
+    pub fn compare(&self, other: &Self) -> Ordering {
+        (self.iso.date, self.iso.time).cmp(&(other.iso.date, other.iso.time))
+    }
+
+    /// Creates a new `DateTime` with the time replaced by the provided `Time`, or midnight when
+    /// `None`.
+    ///
+    /// Equivalent: `Temporal.PlainDateTime.prototype.withPlainTime`
+    pub fn with_time(&self, time: Option<&Time>) -> TemporalResult<Self> {
+        let time = time.map_or_else(IsoTime::default, |time| time.iso);
+        Ok(Self::new_unchecked(
+            IsoDateTime::new(self.iso.date, time)?,
+            self.calendar.clone(),
+        ))
+    }
+
+    /// Creates a new `DateTime` with the provided date and time fields replaced, where
+    /// `overflow` defaults to "constrain".
+    ///
+    /// Equivalent: `Temporal.PlainDateTime.prototype.with`
+    pub fn with(
+        &self,
+        date_fields: &DateFields,
+        time_fields: &TimeFields,
+        overflow: Option<ArithmeticOverflow>,
+        context: &mut C::Context,
+    ) -> TemporalResult<Self> {
+        if date_fields.is_empty() && time_fields.is_empty() {
+            return Err(TemporalError::r#type().with_message("No fields were provided to with."));
+        }
+        let overflow = overflow.unwrap_or(ArithmeticOverflow::Constrain);
+
+        let date = if date_fields.is_empty() {
+            self.iso.date
+        } else {
+            Date::new_unchecked(self.iso.date, self.calendar.clone())
+                .with(date_fields, Some(overflow), context)?
+                .iso
+        };
+        let time = self.iso.time.with(time_fields, overflow)?;
+
+        Ok(Self::new_unchecked(
+            IsoDateTime::new(date, time)?,
+            self.calendar.clone(),
+        ))
+    }
+
+    /// Creates a new `DateTime` with the calendar replaced by the provided calendar.
+    ///
+    /// Equivalent: `Temporal.PlainDateTime.prototype.withCalendar`
+    #[inline]
+    #[must_use]
+    pub fn with_calendar(&self, calendar: CalendarSlot<C>) -> Self {
+        Self::new_unchecked(self.iso, calendar)
+    }
+
+    /// Rounds the current `DateTime` according to provided options.
+    pub fn round(
+        &self,
+        smallest_unit: TemporalUnit,
+        rounding_increment: Option<f64>,
+        rounding_mode: Option<TemporalRoundingMode>,
+    ) -> TemporalResult<Self> {
+        let increment = RoundingIncrement::try_from(rounding_increment.unwrap_or(1.0))?;
+        let mode = rounding_mode.unwrap_or(TemporalRoundingMode::HalfExpand);
+
+        // If smallestUnit is "day", the maximum increment is 1 and inclusive.
+        let (unit_ns, max, inclusive) = match smallest_unit {
+            TemporalUnit::Day => (NS_PER_DAY, 1, true),
+            _ => match smallest_unit.as_nanoseconds() {
+                Some(unit_ns) => {
+                    let max = smallest_unit
+                        .to_maximum_rounding_increment()
+                        .temporal_unwrap()?;
+                    (unit_ns, u64::from(max), false)
+                }
+                None => {
+                    return Err(TemporalError::range()
+                        .with_message("smallestUnit must be a time value or day."))
+                }
+            },
+        };
+        increment.validate(max, inclusive)?;
+
+        // NOTE: The nanoseconds since the start of the day are rounded with the integer rounding
+        // kernel, and any carry into the next day is applied to the epoch nanoseconds.
+        let time = self.iso.time.as_nanoseconds();
+        let increment = NonZeroU64::new(unit_ns)
+            .and_then(|ns| ns.checked_mul(increment.as_extended_increment()))
+            .temporal_unwrap()?;
+        let rounded = IncrementRounder::<i128>::from_positive_parts(time, increment)?.round(mode);
+
+        let iso = IsoDateTime::from_nanoseconds(self.iso.as_nanoseconds() - time + rounded);
+        if !iso.is_within_limits() {
+            return Err(
+                TemporalError::range().with_message("DateTime is not within a valid range.")
+            );
+        }
+        Ok(Self::new_unchecked(iso, self.calendar.clone()))
+    }
 }
 
 // ==== Calendar-derived public API ====
@@ -300,6 +660,46 @@ impl DateTime<()> {
     ) -> TemporalResult<Self> {
         self.contextual_subtract(duration, overflow, &mut ())
     }
+
+    /// Returns the `Duration` until the provided `DateTime` from the current `DateTime`.
+    #[inline]
+    pub fn until(
+        &self,
+        other: &Self,
+        rounding_mode: Option<TemporalRoundingMode>,
+        rounding_increment: Option<RoundingIncrement>,
+        largest_unit: Option<TemporalUnit>,
+        smallest_unit: Option<TemporalUnit>,
+    ) -> TemporalResult<Duration> {
+        self.contextual_until(
+            other,
+            rounding_mode,
+            rounding_increment,
+            largest_unit,
+            smallest_unit,
+            &mut (),
+        )
+    }
+
+    /// Returns the `Duration` since the provided `DateTime` from the current `DateTime`.
+    #[inline]
+    pub fn since(
+        &self,
+        other: &Self,
+        rounding_mode: Option<TemporalRoundingMode>,
+        rounding_increment: Option<RoundingIncrement>,
+        largest_unit: Option<TemporalUnit>,
+        smallest_unit: Option<TemporalUnit>,
+    ) -> TemporalResult<Duration> {
+        self.contextual_since(
+            other,
+            rounding_mode,
+            rounding_increment,
+            largest_unit,
+            smallest_unit,
+            &mut (),
+        )
+    }
 }
 
 impl<C: CalendarProtocol> DateTime<C> {
@@ -430,6 +830,50 @@ impl<C: CalendarProtocol> DateTime<C> {
     ) -> TemporalResult<Self> {
         self.add_or_subtract_duration(&duration.negated(), overflow, context)
     }
+
+    /// Returns the `Duration` until the provided `DateTime` with provided context.
+    #[inline]
+    pub fn contextual_until(
+        &self,
+        other: &Self,
+        rounding_mode: Option<TemporalRoundingMode>,
+        rounding_increment: Option<RoundingIncrement>,
+        largest_unit: Option<TemporalUnit>,
+        smallest_unit: Option<TemporalUnit>,
+        context: &mut C::Context,
+    ) -> TemporalResult<Duration> {
+        self.diff(
+            false,
+            other,
+            rounding_mode,
+            rounding_increment,
+            largest_unit,
+            smallest_unit,
+            context,
+        )
+    }
+
+    /// Returns the `Duration` since the provided `DateTime` with provided context.
+    #[inline]
+    pub fn contextual_since(
+        &self,
+        other: &Self,
+        rounding_mode: Option<TemporalRoundingMode>,
+        rounding_increment: Option<RoundingIncrement>,
+        largest_unit: Option<TemporalUnit>,
+        smallest_unit: Option<TemporalUnit>,
+        context: &mut C::Context,
+    ) -> TemporalResult<Duration> {
+        self.diff(
+            true,
+            other,
+            rounding_mode,
+            rounding_increment,
+            largest_unit,
+            smallest_unit,
+            context,
+        )
+    }
 }
 
 // ==== Trait impls ====
@@ -483,11 +927,13 @@ impl<C: CalendarProtocol> FromStr for DateTime<C> {
 
 #[cfg(test)]
 mod tests {
-    use std::str::FromStr;
+    use std::{cmp::Ordering, str::FromStr};
 
     use crate::{
-        components::{calendar::CalendarSlot, Duration},
+        components::{calendar::CalendarSlot, duration::TimeDuration, Duration, Time},
         iso::{IsoDate, IsoTime},
+        options::{ArithmeticOverflow, TemporalRoundingMode, TemporalUnit},
+        DateFields, TimeFields,
     };
 
     use super::DateTime;
@@ -516,6 +962,44 @@ mod tests {
         assert!(positive_limit.is_err());
     }
 
+    #[test]
+    fn plain_date_time_limit_boundaries() {
+        let new = |date: (i32, i32, i32), ns: i32| {
+            DateTime::<()>::new(
+                date.0,
+                date.1,
+                date.2,
+                0,
+                0,
+                0,
+                0,
+                0,
+                ns,
+                CalendarSlot::default(),
+            )
+        };
+        assert!(new((-271_821, 4, 19), 0).is_err());
+        assert!(new((-271_821, 4, 19), 1).is_ok());
+        assert!(new((275_760, 9, 13), 0).is_ok());
+        assert!(new((275_760, 9, 14), 0).is_err());
+        assert!(new((-300_000, 1, 1), 0).is_err());
+        assert!(new((300_000, 1, 1), 0).is_err());
+
+        let max = DateTime::<()>::new(
+            275_760,
+            9,
+            13,
+            23,
+            59,
+            59,
+            999,
+            999,
+            999,
+            CalendarSlot::default(),
+        );
+        assert!(max.is_ok());
+    }
+
     // options-undefined.js
     #[test]
     fn datetime_add_test() {
@@ -623,4 +1107,232 @@ mod tests {
             }
         );
     }
+
+    fn datetime(date: (i32, i32, i32), time: (i32, i32, i32, i32)) -> DateTime<()> {
+        DateTime::<()>::new(
+            date.0,
+            date.1,
+            date.2,
+            time.0,
+            time.1,
+            time.2,
+            time.3,
+            0,
+            0,
+            CalendarSlot::default(),
+        )
+        .unwrap()
+    }
+
+    #[test]
+    fn datetime_until_and_since() {
+        let start = datetime((2020, 1, 1), (0, 0, 0, 0));
+        let end = datetime((2020, 3, 15), (12, 30, 45, 500));
+
+        let result = start.until(&end, None, None, None, None).unwrap();
+        assert_eq!(result.days(), 74.0);
+        assert_eq!(result.hours(), 12.0);
+        assert_eq!(result.minutes(), 30.0);
+        assert_eq!(result.seconds(), 45.0);
+        assert_eq!(result.milliseconds(), 500.0);
+
+        let result = end.since(&start, None, None, None, None).unwrap();
+        assert_eq!(result.days(), 74.0);
+        assert_eq!(result.milliseconds(), 500.0);
+
+        let result = start.since(&end, None, None, None, None).unwrap();
+        assert_eq!(result.days(), -74.0);
+        assert_eq!(result.hours(), -12.0);
+
+        // The end time is earlier in the day than the start time.
+        let start = datetime((2020, 1, 1), (12, 0, 0, 0));
+        let end = datetime((2020, 1, 3), (6, 0, 0, 0));
+        let result = start.until(&end, None, None, None, None).unwrap();
+        assert_eq!((result.days(), result.hours()), (1.0, 18.0));
+        let result = start
+            .until(&end, None, None, Some(TemporalUnit::Hour), None)
+            .unwrap();
+        assert_eq!((result.days(), result.hours()), (0.0, 42.0));
+        let result = end
+            .until(&start, None, None, Some(TemporalUnit::Hour), None)
+            .unwrap();
+        assert_eq!(result.hours(), -42.0);
+
+        assert!(start
+            .until(
+                &end,
+                None,
+                None,
+                Some(TemporalUnit::Hour),
+                Some(TemporalUnit::Day)
+            )
+            .is_err());
+        assert!(start
+            .until(&start, None, None, None, None)
+            .unwrap()
+            .is_zero());
+    }
+
+    #[test]
+    fn datetime_until_rounding() {
+        let start = datetime((2020, 1, 1), (0, 0, 0, 0));
+        let end = datetime((2020, 1, 31), (23, 59, 59, 999));
+
+        // Rounding the time carries into the date difference.
+        let result = start
+            .until(
+                &end,
+                Some(TemporalRoundingMode::HalfExpand),
+                None,
+                None,
+                Some(TemporalUnit::Second),
+            )
+            .unwrap();
+        assert_eq!((result.days(), result.hours()), (31.0, 0.0));
+
+        let result = start
+            .until(
+                &end,
+                Some(TemporalRoundingMode::HalfExpand),
+                None,
+                Some(TemporalUnit::Month),
+                Some(TemporalUnit::Second),
+            )
+            .unwrap();
+        assert_eq!((result.months(), result.days()), (1.0, 0.0));
+
+        let result = start
+            .until(&end, None, None, None, Some(TemporalUnit::Hour))
+            .unwrap();
+        assert_eq!((result.days(), result.hours()), (30.0, 23.0));
+        assert_eq!(result.minutes(), 0.0);
+
+        let end = datetime((2020, 1, 2), (13, 0, 0, 0));
+        let result = start
+            .until(
+                &end,
+                Some(TemporalRoundingMode::HalfExpand),
+                None,
+                None,
+                Some(TemporalUnit::Day),
+            )
+            .unwrap();
+        assert_eq!((result.days(), result.hours()), (2.0, 0.0));
+    }
+
+    #[test]
+    fn datetime_round() {
+        let dt = datetime((2020, 12, 31), (23, 59, 30, 0));
+
+        let result = dt.round(TemporalUnit::Minute, None, None).unwrap();
+        assert_eq!(result.iso.date, IsoDate::new_unchecked(2021, 1, 1));
+        assert_eq!(result.iso.time, IsoTime::default());
+
+        let result = dt
+            .round(
+                TemporalUnit::Minute,
+                Some(15.0),
+                Some(TemporalRoundingMode::Floor),
+            )
+            .unwrap();
+        assert_eq!((result.hour(), result.minute()), (23, 45));
+
+        let result = datetime((2020, 6, 1), (11, 59, 0, 0))
+            .round(TemporalUnit::Day, None, None)
+            .unwrap();
+        assert_eq!(result.iso.date, IsoDate::new_unchecked(2020, 6, 1));
+        assert_eq!(result.hour(), 0);
+
+        assert!(dt.round(TemporalUnit::Hour, Some(5.0), None).is_err());
+        assert!(dt.round(TemporalUnit::Day, Some(2.0), None).is_err());
+        assert!(dt.round(TemporalUnit::Month, None, None).is_err());
+    }
+
+    #[test]
+    fn datetime_compare_and_with() {
+        let earlier = datetime((2020, 1, 1), (12, 0, 0, 0));
+        let later = datetime((2020, 1, 1), (12, 0, 0, 1));
+        assert_eq!(earlier.compare(&later), Ordering::Less);
+        assert_eq!(later.compare(&earlier), Ordering::Greater);
+        assert_eq!(earlier.compare(&earlier.clone()), Ordering::Equal);
+
+        let time = Time::new(8, 30, 0, 0, 0, 0, ArithmeticOverflow::Reject).unwrap();
+        let result = earlier.with_time(Some(&time)).unwrap();
+        assert_eq!(result.iso.date, earlier.iso.date);
+        assert_eq!((result.hour(), result.minute()), (8, 30));
+        assert_eq!(earlier.with_time(None).unwrap().hour(), 0);
+    }
+
+    #[test]
+    fn datetime_add_days_and_time() {
+        let dt = datetime((2020, 2, 28), (22, 30, 0, 0));
+
+        let result = dt.add(&Duration::hour(3.0), None).unwrap();
+        assert_eq!(result.iso.date, IsoDate::new_unchecked(2020, 2, 29));
+        assert_eq!((result.hour(), result.minute()), (1, 30));
+
+        let time = TimeDuration::new(25.0, 30.0, 0.0, 0.0, 0.0, 1.0).unwrap();
+        let result = dt
+            .add(&Duration::from_day_and_time(1.0, &time), None)
+            .unwrap();
+        assert_eq!(result.iso.date, IsoDate::new_unchecked(2020, 3, 2));
+        assert_eq!((result.hour(), result.minute()), (0, 0));
+        assert_eq!(result.nanosecond(), 1);
+
+        let result = dt
+            .subtract(&Duration::from_day_and_time(60.0, &time), None)
+            .unwrap();
+        assert_eq!(result.iso.date, IsoDate::new_unchecked(2019, 12, 29));
+        assert_eq!((result.hour(), result.minute()), (20, 59));
+        assert_eq!(result.nanosecond(), 999);
+
+        // Results outside of the valid limits are a RangeError.
+        let max = datetime((275_760, 9, 12), (23, 0, 0, 0));
+        assert!(max.add(&Duration::hour(1.0), None).is_ok());
+        assert!(max.add(&Duration::hour(25.0), None).is_err());
+        assert!(dt
+            .subtract(&Duration::from_day_and_time(200_000_000.0, &time), None)
+            .is_err());
+        // Day counts that overflow the nanosecond arithmetic are a RangeError.
+        for days in [1e30, -1e30, 1e40, f64::MAX, f64::INFINITY, f64::NAN] {
+            let duration = Duration::from_day_and_time(days, &TimeDuration::default());
+            assert!(
+                dt.add(&duration, None).is_err(),
+                "{days} days should not add."
+            );
+        }
+    }
+
+    #[test]
+    fn date_time_with() {
+        let base =
+            DateTime::<()>::new(2024, 1, 31, 12, 0, 0, 0, 0, 0, CalendarSlot::default()).unwrap();
+
+        let result = base
+            .with(
+                &DateFields::new().with_month(2),
+                &TimeFields::new().with_hour(23),
+                None,
+                &mut (),
+            )
+            .unwrap();
+        assert_eq!(result.iso.date, IsoDate::new_unchecked(2024, 2, 29));
+        assert_eq!(result.hour(), 23);
+
+        // Only the time is replaced, which keeps the date as is.
+        let result = base
+            .with(
+                &DateFields::new(),
+                &TimeFields::new().with_minute(59),
+                None,
+                &mut (),
+            )
+            .unwrap();
+        assert_eq!(result.iso.date, base.iso.date);
+        assert_eq!(result.minute(), 59);
+
+        assert!(base
+            .with(&DateFields::new(), &TimeFields::new(), None, &mut ())
+            .is_err());
+    }
 }
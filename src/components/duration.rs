@@ -1,19 +1,25 @@
 //! This module implements `Duration` along with it's methods and components.
 
 use crate::{
-    components::DateTime,
+    components::{Date, DateTime},
     options::{RelativeTo, RoundingIncrement, TemporalRoundingMode, TemporalUnit},
-    TemporalError, TemporalResult,
+    parsers, TemporalError, TemporalResult, NS_PER_DAY,
+};
+use core::fmt;
+use num_bigint::BigInt;
+use num_traits::{FromPrimitive, ToPrimitive};
+use std::{cmp::Ordering, str::FromStr};
+
+use self::{
+    normalized::{NormalizedDurationRecord, NormalizedTimeDuration},
+    relative::RelativeDateCache,
 };
-use ixdtf::parsers::{records::TimeDurationRecord, IsoDurationParser};
-use std::str::FromStr;
-
-use self::normalized::{NormalizedDurationRecord, NormalizedTimeDuration};
 
 use super::{calendar::CalendarProtocol, tz::TzProtocol};
 
 mod date;
 pub(crate) mod normalized;
+mod relative;
 mod time;
 
 #[cfg(test)]
@@ -22,6 +28,8 @@ mod tests;
 #[doc(inline)]
 pub use date::DateDuration;
 #[doc(inline)]
+pub use relative::{RoundingContext, RELATIVE_DATE_CACHE_CAPACITY};
+#[doc(inline)]
 pub use time::TimeDuration;
 
 /// The native Rust implementation of `Temporal.Duration`.
@@ -68,7 +76,7 @@ impl Duration {
     /// Utility function to create a year duration.
     #[inline]
     pub(crate) fn one_year(year_value: f64) -> Self {
-        Self::from_date_duration(&DateDuration::new_unchecked(year_value, 1f64, 0f64, 0f64))
+        Self::from_date_duration(&DateDuration::new_unchecked(year_value, 0f64, 0f64, 0f64))
     }
 
     /// Utility function to create a month duration.
@@ -358,6 +366,16 @@ impl Duration {
     }
 }
 
+/// The resolved options of `Duration::round`.
+#[derive(Debug, Clone, Copy)]
+struct ResolvedRoundingOptions {
+    increment: RoundingIncrement,
+    mode: TemporalRoundingMode,
+    smallest_unit: TemporalUnit,
+    largest_unit: TemporalUnit,
+    relative_to_will_be_used: bool,
+}
+
 // ==== Private Duration methods ====
 
 impl Duration {
@@ -374,16 +392,40 @@ impl Duration {
         relative_to: &RelativeTo<C, Z>,
         precalculated_dt: Option<DateTime<C>>,
         context: &mut C::Context,
+    ) -> TemporalResult<(NormalizedDurationRecord, f64)> {
+        self.round_internal_with_cache(
+            increment,
+            unit,
+            rounding_mode,
+            relative_to,
+            precalculated_dt,
+            &mut RelativeDateCache::disabled(),
+            context,
+        )
+    }
+
+    /// `RoundDuration` with the calendar operations performed through a `RelativeDateCache`.
+    #[allow(clippy::type_complexity, clippy::too_many_arguments)]
+    fn round_internal_with_cache<C: CalendarProtocol, Z: TzProtocol>(
+        &self,
+        increment: RoundingIncrement,
+        unit: TemporalUnit,
+        rounding_mode: TemporalRoundingMode,
+        relative_to: &RelativeTo<C, Z>,
+        precalculated_dt: Option<DateTime<C>>,
+        cache: &mut RelativeDateCache<C>,
+        context: &mut C::Context,
     ) -> TemporalResult<(NormalizedDurationRecord, f64)> {
         match unit {
             TemporalUnit::Year | TemporalUnit::Month | TemporalUnit::Week | TemporalUnit::Day => {
-                let round_result = self.date().round(
+                let round_result = self.date().round_with_cache(
                     Some(self.time.to_normalized()),
                     increment,
                     unit,
                     rounding_mode,
                     relative_to,
                     precalculated_dt,
+                    cache,
                     context,
                 )?;
                 let norm_record = NormalizedDurationRecord::new(
@@ -410,58 +452,19 @@ impl Duration {
         // minutes, seconds, milliseconds, microseconds, nanoseconds).
         // 19. Return the Record { [[DurationRecord]]: duration, [[Total]]: total }.
     }
-}
-
-// ==== Public Duration methods ====
-
-impl Duration {
-    /// Determines the sign for the current self.
-    #[inline]
-    #[must_use]
-    pub fn sign(&self) -> i32 {
-        duration_sign(&self.fields())
-    }
 
-    /// Returns whether the current `Duration` is zero.
+    /// Resolves and validates the options of `Duration::round`, returning `None` when rounding
+    /// has no effect on the current `Duration`.
     ///
-    /// Equivalant to `Temporal.Duration.blank()`.
-    #[inline]
-    #[must_use]
-    pub fn is_zero(&self) -> bool {
-        self.sign() == 0
-    }
-
-    /// Returns a negated `Duration`
-    #[inline]
-    #[must_use]
-    pub fn negated(&self) -> Self {
-        Self {
-            date: self.date().negated(),
-            time: self.time().negated(),
-        }
-    }
-
-    /// Returns the absolute value of `Duration`.
-    #[inline]
-    #[must_use]
-    pub fn abs(&self) -> Self {
-        Self {
-            date: self.date().abs(),
-            time: self.time().abs(),
-        }
-    }
-
-    /// Rounds the current `Duration`.
-    #[inline]
-    pub fn round<C: CalendarProtocol, Z: TzProtocol>(
+    /// Equivalent to steps 1-33 of `Temporal.Duration.prototype.round`
+    fn resolve_round_options(
         &self,
         increment: Option<RoundingIncrement>,
         smallest_unit: Option<TemporalUnit>,
         largest_unit: Option<TemporalUnit>,
         rounding_mode: Option<TemporalRoundingMode>,
-        relative_to: &RelativeTo<C, Z>,
-        context: &mut C::Context,
-    ) -> TemporalResult<Self> {
+        zoned_relative_to: bool,
+    ) -> TemporalResult<Option<ResolvedRoundingOptions>> {
         // NOTE: Steps 1-14 seem to be implementation specific steps.
 
         // 22. If smallestUnitPresent is false and largestUnitPresent is false, then
@@ -519,7 +522,7 @@ impl Duration {
         // 27. If duration.[[Days]] ≠ 0 and zonedRelativeTo is not undefined, set hoursToDaysConversionMayOccur to true.
         // 28. Else if abs(duration.[[Hours]]) ≥ 24, set hoursToDaysConversionMayOccur to true.
         let hours_to_days_may_occur =
-            (self.days() != 0.0 && relative_to.zdt.is_some()) || self.hours().abs() >= 24.0;
+            (self.days() != 0.0 && zoned_relative_to) || self.hours().abs() >= 24.0;
 
         // 29. If smallestUnit is "nanosecond" and roundingIncrement = 1, let roundingGranularityIsNoop
         // be true; else let roundingGranularityIsNoop be false.
@@ -551,21 +554,517 @@ impl Duration {
             // duration.[[Weeks]], duration.[[Days]], duration.[[Hours]], duration.[[Minutes]],
             // duration.[[Seconds]], duration.[[Milliseconds]], duration.[[Microseconds]],
             // duration.[[Nanoseconds]]).
-            return Ok(*self);
+            return Ok(None);
         }
 
         // 32. Let precalculatedPlainDateTime be undefined.
         // 33. If roundingGranularityIsNoop is false, or IsCalendarUnit(largestUnit) is true, or largestUnit is "day",
         // or calendarUnitsPresent is true, or duration.[[Days]] ≠ 0, let plainDateTimeOrRelativeToWillBeUsed be true;
         // else let plainDateTimeOrRelativeToWillBeUsed be false.
-        let pdtr_will_be_used = !is_noop
+        let relative_to_will_be_used = !is_noop
             || largest_unit.is_calendar_unit()
             || largest_unit == TemporalUnit::Day
             || calendar_units_present
             || self.days() == 0.0;
 
+        Ok(Some(ResolvedRoundingOptions {
+            increment,
+            mode,
+            smallest_unit,
+            largest_unit,
+            relative_to_will_be_used,
+        }))
+    }
+
+    /// Balances the time of a rounded duration record up to `largest_unit`, returning the
+    /// intermediate `DateDuration` and the balanced `TimeDuration`.
+    ///
+    /// Equivalent to step 41 of `Temporal.Duration.prototype.round`
+    fn balance_rounded(
+        round_result: &NormalizedDurationRecord,
+        largest_unit: TemporalUnit,
+    ) -> TemporalResult<(DateDuration, TimeDuration)> {
+        // NOTE: DateDuration::round will always return a NormalizedTime::default as per spec.
+        // a. Let normWithDays be ? Add24HourDaysToNormalizedTimeDuration(roundResult.[[NormalizedTime]], roundResult.[[Days]]).
+        let (date, norm) = &round_result.0;
+        let norm_with_days = norm.add_days(date.days as i64)?;
+        // b. Let balanceResult be BalanceTimeDuration(normWithDays, largestUnit).
+        let (days, time) = TimeDuration::from_normalized(norm_with_days, largest_unit)?;
+
+        let intermediate = DateDuration::new_unchecked(date.years, date.months, date.weeks, days);
+        Ok((intermediate, time))
+    }
+
+    /// Returns the exact total of a time unit, or of 24-hour days, for the normalized time of
+    /// the current `Duration` after adding `days`.
+    fn total_exact(&self, days: f64, unit: TemporalUnit) -> TemporalResult<f64> {
+        let norm = self.time.to_normalized().add_days(days as i64)?;
+        let divisor = unit.as_nanoseconds().unwrap_or(NS_PER_DAY);
+        Ok(norm.divide_exact(divisor))
+    }
+
+    /// Returns the total of a calendar unit for the current `Duration` relative to the provided `Date`.
+    ///
+    /// Rather than iterating one unit at a time, the whole units are determined with a single
+    /// `dateUntil` call and only the bounding units are then added to `plainRelativeTo`.
+    fn total_calendar_unit<C: CalendarProtocol>(
+        &self,
+        unit: TemporalUnit,
+        plain_relative_to: &Date<C>,
+        cache: &mut RelativeDateCache<C>,
+        context: &mut C::Context,
+    ) -> TemporalResult<f64> {
+        let sign = i128::from(self.sign());
+        let norm = self.time.to_normalized().0;
+        let ns_per_day = i128::from(NS_PER_DAY);
+        let (norm_days, remainder) = (norm.div_euclid(ns_per_day), norm.rem_euclid(ns_per_day));
+
+        let unit_duration = |value: f64| match unit {
+            TemporalUnit::Year => Self::one_year(value),
+            TemporalUnit::Month => Self::one_month(value),
+            _ => Self::one_week(value),
+        };
+        let position = |date: &Date<C>| i128::from(plain_relative_to.days_until(date)) * ns_per_day;
+
+        // Move to the date that the current `Duration` ends on.
+        let end_date = cache.add_date(
+            plain_relative_to,
+            &Self::from_date_duration(&DateDuration::new_unchecked(
+                self.years(),
+                self.months(),
+                self.weeks(),
+                self.days() + norm_days as f64,
+            )),
+            context,
+        )?;
+        let end = position(&end_date) + remainder;
+
+        // Determine the whole units between `plainRelativeTo` and the end date.
+        let until = cache.diff_date(plain_relative_to, &end_date, unit, context)?;
+        let mut whole = match unit {
+            TemporalUnit::Year => until.years(),
+            TemporalUnit::Month => until.months(),
+            _ => until.weeks(),
+        };
+
+        // Resolve both unit boundaries surrounding the end position with a single calendar call.
+        let bounds = cache.calendar_date_add_durations(
+            plain_relative_to,
+            &[unit_duration(whole), unit_duration(whole + sign as f64)],
+            context,
+        )?;
+        let (mut start, mut next) = match bounds.as_slice() {
+            [start, next] => (position(start), position(next)),
+            _ => return Err(TemporalError::assert()),
+        };
+        // NOTE: The end date is floored to a whole day, so a negative `Duration` with a time
+        // remainder may be a unit too far from zero.
+        if (end - start) * sign < 0 {
+            whole -= sign as f64;
+            next = start;
+            start = position(&cache.add_date(plain_relative_to, &unit_duration(whole), context)?);
+        }
+
+        if next == start {
+            return Err(TemporalError::range().with_message("Calendar unit length cannot be zero."));
+        }
+
+        Ok(whole + sign as f64 * ((end - start) as f64 / (next - start) as f64))
+    }
+}
+
+// ==== Public Duration methods ====
+
+impl Duration {
+    /// Determines the sign for the current self.
+    #[inline]
+    #[must_use]
+    pub fn sign(&self) -> i32 {
+        duration_sign(&self.fields())
+    }
+
+    /// Returns whether the current `Duration` is zero.
+    ///
+    /// Equivalant to `Temporal.Duration.blank()`.
+    #[inline]
+    #[must_use]
+    pub fn is_zero(&self) -> bool {
+        self.sign() == 0
+    }
+
+    /// Returns a negated `Duration`
+    #[inline]
+    #[must_use]
+    pub fn negated(&self) -> Self {
+        Self {
+            date: self.date().negated(),
+            time: self.time().negated(),
+        }
+    }
+
+    /// Returns the absolute value of `Duration`.
+    #[inline]
+    #[must_use]
+    pub fn abs(&self) -> Self {
+        Self {
+            date: self.date().abs(),
+            time: self.time().abs(),
+        }
+    }
+
+    /// Returns the total of the current `Duration` in the provided `TemporalUnit`.
+    ///
+    /// Time units, and days when no calendar units are present, are computed exactly from the
+    /// normalized time duration without any balancing. `relative_to` is only required when
+    /// calendar units are present or requested.
+    ///
+    /// Equivalent: `Temporal.Duration.prototype.total`
+    #[inline]
+    pub fn total<C: CalendarProtocol, Z: TzProtocol>(
+        &self,
+        unit: TemporalUnit,
+        relative_to: &RelativeTo<C, Z>,
+        context: &mut C::Context,
+    ) -> TemporalResult<f64> {
+        self.total_with_cache(
+            unit,
+            relative_to,
+            &mut RelativeDateCache::disabled(),
+            context,
+        )
+    }
+
+    /// Rounds the current `Duration`.
+    #[inline]
+    pub fn round<C: CalendarProtocol, Z: TzProtocol>(
+        &self,
+        increment: Option<RoundingIncrement>,
+        smallest_unit: Option<TemporalUnit>,
+        largest_unit: Option<TemporalUnit>,
+        rounding_mode: Option<TemporalRoundingMode>,
+        relative_to: &RelativeTo<C, Z>,
+        context: &mut C::Context,
+    ) -> TemporalResult<Self> {
+        self.round_with_cache(
+            increment,
+            smallest_unit,
+            largest_unit,
+            rounding_mode,
+            relative_to,
+            &mut RelativeDateCache::disabled(),
+            context,
+        )
+    }
+
+    /// Compares the current `Duration` with another `Duration`.
+    ///
+    /// When neither `Duration` has calendar units, the two are compared exactly as
+    /// nanoseconds with days treated as 24 hours, and `relative_to` is not used. Otherwise,
+    /// the calendar units of both are resolved into days relative to `relative_to`.
+    ///
+    /// Equivalent: `Temporal.Duration.compare`
+    pub fn compare<C: CalendarProtocol, Z: TzProtocol>(
+        &self,
+        other: &Self,
+        relative_to: &RelativeTo<C, Z>,
+        context: &mut C::Context,
+    ) -> TemporalResult<Ordering> {
+        let calendar_units_present = |duration: &Self| {
+            !(duration.years() == 0.0 && duration.months() == 0.0 && duration.weeks() == 0.0)
+        };
+        // NOTE: Step 5 only matters when calendar units or a zonedRelativeTo would be
+        // resolved, as equal durations otherwise compare equal as nanoseconds.
+        // 5. If one.[[Years]] = two.[[Years]], and ... one.[[Nanoseconds]] = two.[[Nanoseconds]], then
+        if (calendar_units_present(self)
+            || calendar_units_present(other)
+            || relative_to.zdt.is_some())
+            && self.fields() == other.fields()
+        {
+            // a. Return +0𝔽.
+            return Ok(Ordering::Equal);
+        }
+
+        let mut cache = RelativeDateCache::disabled();
+        let one = self.comparison_nanoseconds(relative_to, &mut cache, context)?;
+        let two = other.comparison_nanoseconds(relative_to, &mut cache, context)?;
+        // 13. Return 𝔽(CompareNormalizedTimeDuration(norm1, norm2)).
+        Ok(one.cmp(&two))
+    }
+
+    /// Sorts a slice of `Duration`s in ascending order.
+    ///
+    /// Each `Duration` is resolved into nanoseconds only once, and the calendar operations
+    /// relative to `relative_to` are shared between all of them. The sort is stable.
+    pub fn sort<C: CalendarProtocol, Z: TzProtocol>(
+        durations: &mut [Self],
+        relative_to: &RelativeTo<C, Z>,
+        context: &mut C::Context,
+    ) -> TemporalResult<()> {
+        let mut cache = RelativeDateCache::enabled();
+        let mut keyed = durations
+            .iter()
+            .map(|duration| {
+                let key = duration.comparison_nanoseconds(relative_to, &mut cache, context)?;
+                Ok((key, *duration))
+            })
+            .collect::<TemporalResult<Vec<_>>>()?;
+        keyed.sort_by_key(|(key, _)| *key);
+
+        for (slot, (_, duration)) in durations.iter_mut().zip(keyed) {
+            *slot = duration;
+        }
+        Ok(())
+    }
+}
+
+// ==== Duration string methods ====
+
+impl Duration {
+    /// Writes the canonical ISO 8601 string of the current `Duration` to `out`, i.e.
+    /// `-P1Y2M3W4DT5H6M7.123456789S`.
+    ///
+    /// The subsecond units are balanced into the seconds exactly, and trailing zeros of the
+    /// fraction are omitted. Only seconds that do not fit an `i128` once balanced allocate.
+    ///
+    /// Equivalent: `TemporalDurationToString` with a precision of "auto"
+    pub fn write_to<W: fmt::Write + ?Sized>(&self, out: &mut W) -> fmt::Result {
+        const NS_PER_SECOND: i128 = 1_000_000_000;
+        let subseconds = [
+            (self.seconds(), NS_PER_SECOND),
+            (self.milliseconds(), 1_000_000),
+            (self.microseconds(), 1_000),
+            (self.nanoseconds(), 1),
+        ];
+
+        // 9. Let secondsDuration be TimeDurationFromComponents(0, 0, seconds, ms, µs, ns).
+        // NOTE: All fields have the same sign, so the absolute values are balanced. A float to
+        // integer cast saturates, so only values below `i128::MAX` are cast.
+        let exact = subseconds.iter().try_fold(0i128, |total, (value, scale)| {
+            let value = value.abs().trunc();
+            if value >= i128::MAX as f64 {
+                return None;
+            }
+            (value as i128).checked_mul(*scale)?.checked_add(total)
+        });
+        let (exact_seconds, big_seconds);
+        let (seconds, seconds_are_zero, fraction): (&dyn fmt::Display, bool, i128) = match exact {
+            Some(total) => {
+                exact_seconds = total / NS_PER_SECOND;
+                (&exact_seconds, exact_seconds == 0, total % NS_PER_SECOND)
+            }
+            None => {
+                let total: BigInt = subseconds
+                    .iter()
+                    .map(|(value, scale)| {
+                        BigInt::from_f64(value.abs().trunc()).unwrap_or_default() * *scale
+                    })
+                    .sum();
+                let fraction = (&total % NS_PER_SECOND).to_i128().unwrap_or_default();
+                big_seconds = total / NS_PER_SECOND;
+                (&big_seconds, false, fraction)
+            }
+        };
+
+        // 1. Let sign be DurationSign(duration).
+        // 2. Let datePart be "".
+        if self.sign() < 0 {
+            out.write_char('-')?;
+        }
+        out.write_char('P')?;
+
+        // 3-6. Append each non-zero date unit with its designator.
+        for (value, designator) in [
+            (self.years(), 'Y'),
+            (self.months(), 'M'),
+            (self.weeks(), 'W'),
+            (self.days(), 'D'),
+        ] {
+            if value != 0.0 {
+                write!(out, "{}{designator}", value.abs())?;
+            }
+        }
+
+        // 10. If secondsDuration ≠ 0, or zeroMinutesAndHigher is true, let secondsPart be ...
+        let zero_minutes_and_higher = self.years() == 0.0
+            && self.months() == 0.0
+            && self.weeks() == 0.0
+            && self.days() == 0.0
+            && self.hours() == 0.0
+            && self.minutes() == 0.0;
+        let write_seconds = !seconds_are_zero || fraction != 0 || zero_minutes_and_higher;
+
+        // 11. Let timePart be "".
+        if self.hours() != 0.0 || self.minutes() != 0.0 || write_seconds {
+            out.write_char('T')?;
+        }
+        if self.hours() != 0.0 {
+            write!(out, "{}H", self.hours().abs())?;
+        }
+        if self.minutes() != 0.0 {
+            write!(out, "{}M", self.minutes().abs())?;
+        }
+        if write_seconds {
+            write!(out, "{seconds}")?;
+            if fraction != 0 {
+                // Omit the trailing zeros of the fraction.
+                let (mut fraction, mut digits) = (fraction, 9);
+                while fraction % 10 == 0 {
+                    fraction /= 10;
+                    digits -= 1;
+                }
+                write!(out, ".{fraction:0digits$}")?;
+            }
+            out.write_char('S')?;
+        }
+        Ok(())
+    }
+}
+
+// ==== Cached Duration methods ====
+
+impl Duration {
+    /// Returns the nanoseconds of the current `Duration` that it is compared by.
+    ///
+    /// Equivalent to steps 6-12 of `Temporal.Duration.compare`
+    fn comparison_nanoseconds<C: CalendarProtocol, Z: TzProtocol>(
+        &self,
+        relative_to: &RelativeTo<C, Z>,
+        cache: &mut RelativeDateCache<C>,
+        context: &mut C::Context,
+    ) -> TemporalResult<i128> {
+        // 6. Let calendarUnitsPresent be false.
+        // 7. If one.[[Years]] ≠ 0, or one.[[Months]] ≠ 0, or one.[[Weeks]] ≠ 0, ... set calendarUnitsPresent to true.
+        let calendar_units_present =
+            !(self.years() == 0.0 && self.months() == 0.0 && self.weeks() == 0.0);
+
+        // 8. If zonedRelativeTo is not undefined, and either calendarUnitsPresent is true, or
+        // one.[[Days]] ≠ 0, or two.[[Days]] ≠ 0, then
+        if relative_to.zdt.is_some() && (calendar_units_present || self.days() != 0.0) {
+            return Err(TemporalError::general("Not yet implemented."));
+        }
+
+        let mut days = self.days();
+        // 9. If calendarUnitsPresent is true, then
+        if calendar_units_present {
+            // a. If plainRelativeTo is undefined, throw a RangeError exception.
+            let plain_relative_to = relative_to.date.ok_or_else(|| {
+                TemporalError::range()
+                    .with_message("relativeTo is required for a Duration with calendar units.")
+            })?;
+            // b. Let days1 be ? DateDurationDays(one.[[Years]], one.[[Months]], one.[[Weeks]], one.[[Days]], plainRelativeTo).
+            let later = cache.add_date(
+                plain_relative_to,
+                &Self::from_date_duration(&DateDuration::new_unchecked(
+                    self.years(),
+                    self.months(),
+                    self.weeks(),
+                    0.0,
+                )),
+                context,
+            )?;
+            days += f64::from(plain_relative_to.days_until(&later));
+        }
+
+        // 11. Let norm1 be NormalizeTimeDuration(one.[[Hours]], one.[[Minutes]], one.[[Seconds]], one.[[Milliseconds]], one.[[Microseconds]], one.[[Nanoseconds]]).
+        // 12. Set norm1 to ? Add24HourDaysToNormalizedTimeDuration(norm1, days1).
+        Ok(self.time.to_normalized().add_days(days as i64)?.0)
+    }
+
+    /// `Duration::total` with the calendar operations performed through a `RelativeDateCache`.
+    pub(crate) fn total_with_cache<C: CalendarProtocol, Z: TzProtocol>(
+        &self,
+        unit: TemporalUnit,
+        relative_to: &RelativeTo<C, Z>,
+        cache: &mut RelativeDateCache<C>,
+        context: &mut C::Context,
+    ) -> TemporalResult<f64> {
+        if unit == TemporalUnit::Auto {
+            return Err(
+                TemporalError::range().with_message("Invalid TemporalUnit for Duration.total")
+            );
+        }
+
+        if relative_to.zdt.is_some() {
+            return Err(TemporalError::general("Not yet implemented."));
+        }
+
+        if self.is_zero() {
+            return Ok(0.0);
+        }
+
+        let calendar_units_present =
+            !(self.years() == 0.0 && self.months() == 0.0 && self.weeks() == 0.0);
+
+        let plain_relative_to = match relative_to.date {
+            Some(date) => date,
+            None if calendar_units_present || unit.is_calendar_unit() => {
+                return Err(TemporalError::range()
+                    .with_message("relativeTo is required for a Duration with calendar units."))
+            }
+            None => {
+                // NOTE: Days are treated as exactly 24 hours without a relativeTo.
+                return self.total_exact(self.days(), unit);
+            }
+        };
+
+        if unit.is_calendar_unit() {
+            return self.total_calendar_unit(unit, plain_relative_to, cache, context);
+        }
+
+        // Only the calendar units need to be resolved into days for a time unit or day total.
+        let mut days = self.days();
+        if calendar_units_present {
+            let later = cache.add_date(
+                plain_relative_to,
+                &Self::from_date_duration(&DateDuration::new_unchecked(
+                    self.years(),
+                    self.months(),
+                    self.weeks(),
+                    0.0,
+                )),
+                context,
+            )?;
+            days += f64::from(plain_relative_to.days_until(&later));
+        }
+
+        self.total_exact(days, unit)
+    }
+
+    /// `Duration::round` with the calendar operations performed through a `RelativeDateCache`.
+    #[allow(clippy::too_many_arguments)]
+    pub(crate) fn round_with_cache<C: CalendarProtocol, Z: TzProtocol>(
+        &self,
+        increment: Option<RoundingIncrement>,
+        smallest_unit: Option<TemporalUnit>,
+        largest_unit: Option<TemporalUnit>,
+        rounding_mode: Option<TemporalRoundingMode>,
+        relative_to: &RelativeTo<C, Z>,
+        cache: &mut RelativeDateCache<C>,
+        context: &mut C::Context,
+    ) -> TemporalResult<Self> {
+        // NOTE: Steps 1-31 do not depend on the calendar or time zone.
+        let options = match self.resolve_round_options(
+            increment,
+            smallest_unit,
+            largest_unit,
+            rounding_mode,
+            relative_to.zdt.is_some(),
+        )? {
+            Some(options) => options,
+            None => return Ok(*self),
+        };
+        let ResolvedRoundingOptions {
+            increment,
+            mode,
+            smallest_unit,
+            largest_unit,
+            ..
+        } = options;
+
+        // 32. Let precalculatedPlainDateTime be undefined.
+        // 33. NOTE: plainDateTimeOrRelativeToWillBeUsed is determined with the rounding options.
         // 34. If zonedRelativeTo is not undefined and plainDateTimeOrRelativeToWillBeUsed is true, then
-        let precalculated = if relative_to.zdt.is_some() && pdtr_will_be_used {
+        let precalculated = if relative_to.zdt.is_some() && options.relative_to_will_be_used {
             return Err(TemporalError::general("Not yet implemented."));
             // a. NOTE: The above conditions mean that the corresponding Temporal.PlainDateTime or
             // Temporal.PlainDate for zonedRelativeTo will be used in one of the operations below.
@@ -582,9 +1081,9 @@ impl Duration {
         let relative_to_date = relative_to.date;
 
         // 36. Let unbalanceResult be ? UnbalanceDateDurationRelative(duration.[[Years]], duration.[[Months]], duration.[[Weeks]], duration.[[Days]], largestUnit, plainRelativeTo, calendarRec).
-        let unbalanced = self
-            .date()
-            .unbalance_relative(largest_unit, relative_to_date, context)?;
+        let unbalanced =
+            self.date()
+                .unbalance_relative(largest_unit, relative_to_date, cache, context)?;
 
         // NOTE: Step 37 handled in round duration
         // 37. Let norm be NormalizeTimeDuration(duration.[[Hours]], duration.[[Minutes]], duration.[[Seconds]],
@@ -592,46 +1091,38 @@ impl Duration {
         // 38. Let roundRecord be ? RoundDuration(unbalanceResult.[[Years]], unbalanceResult.[[Months]],
         // unbalanceResult.[[Weeks]], unbalanceResult.[[Days]], norm, roundingIncrement, smallestUnit,
         // roundingMode, plainRelativeTo, calendarRec, zonedRelativeTo, timeZoneRec, precalculatedPlainDateTime).
-        let (round_result, _) = Self::new_unchecked(unbalanced, *self.time()).round_internal(
-            increment,
-            smallest_unit,
-            mode,
-            relative_to,
-            precalculated,
-            context,
-        )?;
+        let (round_result, _) = Self::new_unchecked(unbalanced, *self.time())
+            .round_internal_with_cache(
+                increment,
+                smallest_unit,
+                mode,
+                relative_to,
+                precalculated,
+                cache,
+                context,
+            )?;
 
         // 39. Let roundResult be roundRecord.[[NormalizedDuration]].
         // 40. If zonedRelativeTo is not undefined, then
-        let balance_result = if relative_to.zdt.is_some() {
+        if relative_to.zdt.is_some() {
             return Err(TemporalError::general("Not yet implemented."));
             // a. Set roundResult to ? AdjustRoundedDurationDays(roundResult.[[Years]], roundResult.[[Months]],
             // roundResult.[[Weeks]], roundResult.[[Days]], roundResult.[[NormalizedTime]], roundingIncrement,
             // smallestUnit, roundingMode, zonedRelativeTo, calendarRec, timeZoneRec, precalculatedPlainDateTime).
             // b. Let balanceResult be ? BalanceTimeDurationRelative(roundResult.[[Days]],
             // roundResult.[[NormalizedTime]], largestUnit, zonedRelativeTo, timeZoneRec, precalculatedPlainDateTime).
-            // 41. Else,
-        } else {
-            // NOTE: DateDuration::round will always return a NormalizedTime::default as per spec.
-            // a. Let normWithDays be ? Add24HourDaysToNormalizedTimeDuration(roundResult.[[NormalizedTime]], roundResult.[[Days]]).
-            let norm_with_days = round_result.0 .1.add_days(round_result.0 .0.days as i64)?;
-            // b. Let balanceResult be BalanceTimeDuration(normWithDays, largestUnit).
-            TimeDuration::from_normalized(norm_with_days, largest_unit)?
-        };
+        }
+        // 41. Else,
+        let (intermediate, balanced_time) = Self::balance_rounded(&round_result, largest_unit)?;
 
         // 42. Let result be ? BalanceDateDurationRelative(roundResult.[[Years]],
         // roundResult.[[Months]], roundResult.[[Weeks]], balanceResult.[[Days]],
         // largestUnit, smallestUnit, plainRelativeTo, calendarRec).
-        let intermediate = DateDuration::new_unchecked(
-            round_result.0 .0.years,
-            round_result.0 .0.months,
-            round_result.0 .0.weeks,
-            balance_result.0,
-        );
-        let result = intermediate.balance_relative(
+        let result = intermediate.balance_relative_with_cache(
             largest_unit,
             smallest_unit,
             relative_to_date,
+            cache,
             context,
         )?;
 
@@ -644,12 +1135,12 @@ impl Duration {
             result.months,
             result.weeks,
             result.days,
-            balance_result.1.hours,
-            balance_result.1.minutes,
-            balance_result.1.seconds,
-            balance_result.1.milliseconds,
-            balance_result.1.microseconds,
-            balance_result.1.nanoseconds,
+            balanced_time.hours,
+            balanced_time.minutes,
+            balanced_time.seconds,
+            balanced_time.milliseconds,
+            balanced_time.microseconds,
+            balanced_time.nanoseconds,
         )
     }
 }
@@ -710,110 +1201,40 @@ impl From<TimeDuration> for Duration {
     }
 }
 
+// ==== Display trait impl ====
+
+impl fmt::Display for Duration {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        self.write_to(f)
+    }
+}
+
 // ==== FromStr trait impl ====
 
 impl FromStr for Duration {
     type Err = TemporalError;
 
     fn from_str(s: &str) -> Result<Self, Self::Err> {
-        let parse_record = IsoDurationParser::new(s)
-            .parse()
-            .map_err(|e| TemporalError::general(format!("{e}")))?;
-
-        let (hours, minutes, seconds, millis, micros, nanos) = match parse_record.time {
-            Some(TimeDurationRecord::Hours { hours, fraction }) => {
-                let minutes = fraction.div_euclid(60 * 1_000_000_000);
-                let rem = fraction.rem_euclid(60 * 1_000_000_000);
-
-                let seconds = rem.div_euclid(1_000_000_000);
-                let rem = rem.rem_euclid(1_000_000_000);
-
-                let milliseconds = rem.div_euclid(1_000_000);
-                let rem = rem.rem_euclid(1_000_000);
-
-                let microseconds = rem.div_euclid(1_000);
-                let nanoseconds = rem.rem_euclid(1_000);
-
-                (
-                    f64::from(hours),
-                    minutes as f64,
-                    seconds as f64,
-                    milliseconds as f64,
-                    microseconds as f64,
-                    nanoseconds as f64,
-                )
-            }
-            // Minutes variant is defined as { hours: u32, minutes: u32, fraction: u64 }
-            Some(TimeDurationRecord::Minutes {
-                hours,
-                minutes,
-                fraction,
-            }) => {
-                let seconds = fraction.div_euclid(1_000_000_000);
-                let rem = fraction.rem_euclid(1_000_000_000);
-
-                let milliseconds = rem.div_euclid(1_000_000);
-                let rem = rem.rem_euclid(1_000_000);
-
-                let microseconds = rem.div_euclid(1_000);
-                let nanoseconds = rem.rem_euclid(1_000);
-
-                (
-                    f64::from(hours),
-                    f64::from(minutes),
-                    seconds as f64,
-                    milliseconds as f64,
-                    microseconds as f64,
-                    nanoseconds as f64,
-                )
-            }
-            // Seconds variant is defined as { hours: u32, minutes: u32, seconds: u32, fraction: u32 }
-            Some(TimeDurationRecord::Seconds {
-                hours,
-                minutes,
-                seconds,
-                fraction,
-            }) => {
-                let milliseconds = fraction.div_euclid(1_000_000);
-                let rem = fraction.rem_euclid(1_000_000);
-
-                let microseconds = rem.div_euclid(1_000);
-                let nanoseconds = rem.rem_euclid(1_000);
-
-                (
-                    f64::from(hours),
-                    f64::from(minutes),
-                    f64::from(seconds),
-                    milliseconds as f64,
-                    microseconds as f64,
-                    nanoseconds as f64,
-                )
-            }
-            None => (0.0, 0.0, 0.0, 0.0, 0.0, 0.0),
-        };
-
-        let (years, months, weeks, days) = if let Some(date) = parse_record.date {
-            (date.years, date.months, date.weeks, date.days)
-        } else {
-            (0, 0, 0, 0)
-        };
+        let record = parsers::parse_duration(s)?;
 
-        let sign = f64::from(parse_record.sign as i8);
+        // NOTE: Every field of the record is at most `MAX_SAFE_INTEGER`, so the casts are exact.
+        let sign = if record.negative { -1.0 } else { 1.0 };
+        let value = |field: u64| field as f64 * sign;
 
         Ok(Self {
             date: DateDuration::new(
-                f64::from(years) * sign,
-                f64::from(months) * sign,
-                f64::from(weeks) * sign,
-                f64::from(days) * sign,
+                value(record.years),
+                value(record.months),
+                value(record.weeks),
+                value(record.days),
             )?,
             time: TimeDuration::new(
-                hours * sign,
-                minutes * sign,
-                seconds * sign,
-                millis * sign,
-                micros * sign,
-                nanos * sign,
+                value(record.hours),
+                value(record.minutes),
+                value(record.seconds),
+                value(record.milliseconds),
+                value(record.microseconds),
+                value(record.nanoseconds),
             )?,
         })
     }
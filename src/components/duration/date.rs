@@ -12,7 +12,7 @@ use crate::{
     TemporalError, TemporalResult, TemporalUnwrap,
 };
 
-use super::normalized::NormalizedTimeDuration;
+use super::{normalized::NormalizedTimeDuration, relative::RelativeDateCache};
 
 /// `DateDuration` represents the [date duration record][spec] of the `Duration.`
 ///
@@ -63,6 +63,7 @@ impl DateDuration {
         &self,
         largest_unit: TemporalUnit,
         plain_relative_to: Option<&Date<C>>,
+        cache: &mut RelativeDateCache<C>,
         context: &mut C::Context,
     ) -> TemporalResult<Self> {
         // 1. Assert: If plainRelativeTo is not undefined, calendarRec is not undefined.
@@ -95,22 +96,12 @@ impl DateDuration {
                     Duration::from_date_duration(&Self::new_unchecked(self.years, 0.0, 0.0, 0.0));
 
                 // c. Let later be ? CalendarDateAdd(calendarRec, plainRelativeTo, yearsDuration).
-                let later = plain_relative.calendar().date_add(
-                    plain_relative,
-                    &years,
-                    ArithmeticOverflow::Constrain,
-                    context,
-                )?;
+                let later = cache.calendar_date_add(plain_relative, &years, context)?;
 
                 // d. Let untilOptions be OrdinaryObjectCreate(null).
                 // e. Perform ! CreateDataPropertyOrThrow(untilOptions, "largestUnit", "month").
                 // f. Let untilResult be ? CalendarDateUntil(calendarRec, plainRelativeTo, later, untilOptions).
-                let until = plain_relative.calendar().date_until(
-                    plain_relative,
-                    &later,
-                    largest_unit,
-                    context,
-                )?;
+                let until = cache.date_until(plain_relative, &later, largest_unit, context)?;
 
                 // g. Let yearsInMonths be untilResult.[[Months]].
                 // h. Return ? CreateDateDurationRecord(0, months + yearsInMonths, weeks, days).
@@ -127,12 +118,7 @@ impl DateDuration {
                 ));
 
                 // b. Let later be ? CalendarDateAdd(calendarRec, plainRelativeTo, yearsMonthsDuration).
-                let later = plain_relative.calendar().date_add(
-                    plain_relative,
-                    &years_months,
-                    ArithmeticOverflow::Constrain,
-                    context,
-                )?;
+                let later = cache.calendar_date_add(plain_relative, &years_months, context)?;
 
                 // c. Let yearsMonthsInDays be DaysUntil(plainRelativeTo, later).
                 let years_months_in_days =
@@ -156,12 +142,8 @@ impl DateDuration {
                 ));
 
                 // 12. Let later be ? CalendarDateAdd(calendarRec, plainRelativeTo, yearsMonthsWeeksDuration).
-                let later = plain_relative.calendar().date_add(
-                    plain_relative,
-                    &years_months_weeks,
-                    ArithmeticOverflow::Constrain,
-                    context,
-                )?;
+                let later =
+                    cache.calendar_date_add(plain_relative, &years_months_weeks, context)?;
 
                 // 13. Let yearsMonthsWeeksInDays be DaysUntil(plainRelativeTo, later).
                 let years_months_weeks_in_days =
@@ -181,12 +163,32 @@ impl DateDuration {
     }
 
     /// 7.5.38 BalanceDateDurationRelative ( years, months, weeks, days, largestUnit, smallestUnit, plainRelativeTo, calendarRec )
+    #[inline]
     pub fn balance_relative<C: CalendarProtocol>(
         &self,
         largest_unit: TemporalUnit,
         smallest_unit: TemporalUnit,
         plain_relative_to: Option<&Date<C>>,
         context: &mut C::Context,
+    ) -> TemporalResult<DateDuration> {
+        self.balance_relative_with_cache(
+            largest_unit,
+            smallest_unit,
+            plain_relative_to,
+            &mut RelativeDateCache::disabled(),
+            context,
+        )
+    }
+
+    /// `BalanceDateDurationRelative` with the calendar operations performed through a
+    /// `RelativeDateCache`.
+    pub(crate) fn balance_relative_with_cache<C: CalendarProtocol>(
+        &self,
+        largest_unit: TemporalUnit,
+        smallest_unit: TemporalUnit,
+        plain_relative_to: Option<&Date<C>>,
+        cache: &mut RelativeDateCache<C>,
+        context: &mut C::Context,
     ) -> TemporalResult<DateDuration> {
         // TODO: Confirm 1 or 5 based off response to issue.
         // 1. Assert: If plainRelativeTo is not undefined, calendarRec is not undefined.
@@ -229,20 +231,10 @@ impl DateDuration {
                     ));
 
                     // iii. Let later be ? AddDate(calendarRec, plainRelativeTo, yearsMonthsDuration).
-                    let later = plain_relative.calendar().date_add(
-                        plain_relative,
-                        &years_months,
-                        ArithmeticOverflow::Constrain,
-                        context,
-                    )?;
+                    let later = cache.calendar_date_add(plain_relative, &years_months, context)?;
 
                     // iv. Let untilResult be ? CalendarDateUntil(calendarRec, plainRelativeTo, later, untilOptions).
-                    let until = plain_relative.calendar().date_until(
-                        plain_relative,
-                        &later,
-                        largest_unit,
-                        context,
-                    )?;
+                    let until = cache.date_until(plain_relative, &later, largest_unit, context)?;
 
                     // v. Return ? CreateDateDurationRecord(untilResult.[[Years]], untilResult.[[Months]], weeks, 0).
                     return Self::new(until.years(), until.months(), self.weeks, 0.0);
@@ -252,19 +244,10 @@ impl DateDuration {
                 let years_months_weeks = Duration::from_date_duration(self);
 
                 // c. Let later be ? AddDate(calendarRec, plainRelativeTo, yearsMonthsWeeksDaysDuration).
-                let later = plain_relative.calendar().date_add(
-                    plain_relative,
-                    &years_months_weeks,
-                    ArithmeticOverflow::Constrain,
-                    context,
-                )?;
+                let later =
+                    cache.calendar_date_add(plain_relative, &years_months_weeks, context)?;
                 // d. Let untilResult be ? CalendarDateUntil(calendarRec, plainRelativeTo, later, untilOptions).
-                let until = plain_relative.calendar().date_until(
-                    plain_relative,
-                    &later,
-                    largest_unit,
-                    context,
-                )?;
+                let until = cache.date_until(plain_relative, &later, largest_unit, context)?;
                 // e. Return ! CreateDateDurationRecord(untilResult.[[Years]], untilResult.[[Months]], untilResult.[[Weeks]], untilResult.[[Days]]).
                 Self::new(until.years(), until.months(), until.weeks(), until.days())
             }
@@ -287,20 +270,10 @@ impl DateDuration {
                 ));
 
                 // d. Let later be ? AddDate(calendarRec, plainRelativeTo, monthsWeeksDaysDuration).
-                let later = plain_relative.calendar().date_add(
-                    plain_relative,
-                    &months_weeks_days,
-                    ArithmeticOverflow::Constrain,
-                    context,
-                )?;
+                let later = cache.calendar_date_add(plain_relative, &months_weeks_days, context)?;
 
                 // e. Let untilResult be ? CalendarDateUntil(calendarRec, plainRelativeTo, later, untilOptions).
-                let until = plain_relative.calendar().date_until(
-                    plain_relative,
-                    &later,
-                    largest_unit,
-                    context,
-                )?;
+                let until = cache.date_until(plain_relative, &later, largest_unit, context)?;
 
                 // f. Return ! CreateDateDurationRecord(0, untilResult.[[Months]], untilResult.[[Weeks]], untilResult.[[Days]]).
                 Self::new(0.0, until.months(), until.weeks(), until.days())
@@ -315,20 +288,10 @@ impl DateDuration {
                 ));
 
                 // 16. Let later be ? AddDate(calendarRec, plainRelativeTo, weeksDaysDuration).
-                let later = plain_relative.calendar().date_add(
-                    plain_relative,
-                    &weeks_days,
-                    ArithmeticOverflow::Constrain,
-                    context,
-                )?;
+                let later = cache.calendar_date_add(plain_relative, &weeks_days, context)?;
 
                 // 17. Let untilResult be ? CalendarDateUntil(calendarRec, plainRelativeTo, later, untilOptions).
-                let until = plain_relative.calendar().date_until(
-                    plain_relative,
-                    &later,
-                    largest_unit,
-                    context,
-                )?;
+                let until = cache.date_until(plain_relative, &later, largest_unit, context)?;
 
                 // 18. Return ! CreateDateDurationRecord(0, 0, untilResult.[[Weeks]], untilResult.[[Days]]).
                 Self::new(0.0, 0.0, until.weeks(), until.days())
@@ -439,6 +402,31 @@ impl DateDuration {
         clippy::too_many_arguments
     )]
     pub fn round<C: CalendarProtocol, Z: TzProtocol>(
+        &self,
+        normalized_time: Option<NormalizedTimeDuration>,
+        increment: RoundingIncrement,
+        unit: TemporalUnit,
+        rounding_mode: TemporalRoundingMode,
+        relative_to: &RelativeTo<C, Z>,
+        precalculated_dt: Option<DateTime<C>>,
+        context: &mut C::Context,
+    ) -> TemporalResult<(Self, f64)> {
+        self.round_with_cache(
+            normalized_time,
+            increment,
+            unit,
+            rounding_mode,
+            relative_to,
+            precalculated_dt,
+            &mut RelativeDateCache::disabled(),
+            context,
+        )
+    }
+
+    /// `DateDuration::round` with the calendar operations performed through a
+    /// `RelativeDateCache`.
+    #[allow(clippy::too_many_arguments)]
+    pub(crate) fn round_with_cache<C: CalendarProtocol, Z: TzProtocol>(
         &self,
         normalized_time: Option<NormalizedTimeDuration>,
         increment: RoundingIncrement,
@@ -446,6 +434,7 @@ impl DateDuration {
         rounding_mode: TemporalRoundingMode,
         relative_to: &RelativeTo<C, Z>,
         _precalculated_dt: Option<DateTime<C>>,
+        cache: &mut RelativeDateCache<C>,
         context: &mut C::Context,
     ) -> TemporalResult<(Self, f64)> {
         // 1. If plainRelativeTo is not present, set plainRelativeTo to undefined.
@@ -504,7 +493,7 @@ impl DateDuration {
                 // i. Let dateAdd be unused.
 
                 // e. Let yearsLater be ? AddDate(calendar, plainRelativeTo, yearsDuration, undefined, dateAdd).
-                let years_later = plain_relative_to.add_date(&years_duration, None, context)?;
+                let years_later = cache.add_date(plain_relative_to, &years_duration, context)?;
 
                 // f. Let yearsMonthsWeeks be ! CreateTemporalDuration(years, months, weeks, 0, 0, 0, 0, 0, 0, 0).
                 let years_months_weeks = Duration::new_unchecked(
@@ -514,7 +503,7 @@ impl DateDuration {
 
                 // g. Let yearsMonthsWeeksLater be ? AddDate(calendar, plainRelativeTo, yearsMonthsWeeks, undefined, dateAdd).
                 let years_months_weeks_later =
-                    plain_relative_to.add_date(&years_months_weeks, None, context)?;
+                    cache.add_date(plain_relative_to, &years_months_weeks, context)?;
 
                 // h. Let monthsWeeksInDays be DaysUntil(yearsLater, yearsMonthsWeeksLater).
                 let months_weeks_in_days = years_later.days_until(&years_months_weeks_later);
@@ -537,7 +526,8 @@ impl DateDuration {
                 // m. Let untilOptions be OrdinaryObjectCreate(null).
                 // n. Perform ! CreateDataPropertyOrThrow(untilOptions, "largestUnit", "year").
                 // o. Let timePassed be ? DifferenceDate(calendar, plainRelativeTo, wholeDaysLater, untilOptions).
-                let time_passed = plain_relative_to.internal_diff_date(
+                let time_passed = cache.diff_date(
+                    &plain_relative_to,
                     &whole_days_later,
                     TemporalUnit::Year,
                     context,
@@ -556,7 +546,7 @@ impl DateDuration {
                 // t. Set plainRelativeTo to moveResult.[[RelativeTo]].
                 // u. Let daysPassed be moveResult.[[Days]].
                 let (plain_relative_to, days_passed) =
-                    plain_relative_to.move_relative_date(&years_duration, context)?;
+                    cache.move_relative_date(&plain_relative_to, &years_duration, context)?;
 
                 // v. Set fractionalDays to fractionalDays - daysPassed.
                 fractional_days -= days_passed;
@@ -570,7 +560,7 @@ impl DateDuration {
                 // y. Set moveResult to ? MoveRelativeDate(calendar, plainRelativeTo, oneYear, dateAdd).
                 // z. Let oneYearDays be moveResult.[[Days]].
                 let (_, one_year_days) =
-                    plain_relative_to.move_relative_date(&one_year, context)?;
+                    cache.move_relative_date(&plain_relative_to, &one_year, context)?;
 
                 if one_year_days == 0.0 {
                     return Err(TemporalError::range().with_message("oneYearDays exceeds ranges."));
@@ -579,15 +569,12 @@ impl DateDuration {
                 let frac_years = years + (fractional_days / one_year_days.abs());
 
                 // ab. Set years to RoundNumberToIncrement(fractionalYears, increment, roundingMode).
-                let rounded_years = IncrementRounder::<f64>::from_potentially_negative_parts(
-                    frac_years,
-                    increment.as_extended_increment(),
-                )?
-                .round(rounding_mode);
+                let rounded_years =
+                    round_number_to_increment(frac_years, increment, rounding_mode)?;
 
                 // ac. Set total to fractionalYears.
                 // ad. Set months and weeks to 0.
-                let result = Self::new(rounded_years as f64, 0f64, 0f64, 0f64)?;
+                let result = Self::new(rounded_years, 0f64, 0f64, 0f64)?;
                 Ok((result, frac_years))
             }
             // 9. Else if unit is "month", then
@@ -610,7 +597,7 @@ impl DateDuration {
 
                 // e. Let yearsMonthsLater be ? AddDate(calendar, plainRelativeTo, yearsMonths, undefined, dateAdd).
                 let years_months_later =
-                    plain_relative_to.add_date(&years_months, None, context)?;
+                    cache.add_date(plain_relative_to, &years_months, context)?;
 
                 // f. Let yearsMonthsWeeks be ! CreateTemporalDuration(years, months, weeks, 0, 0, 0, 0, 0, 0, 0).
                 let years_months_weeks = Duration::from_date_duration(
@@ -619,7 +606,7 @@ impl DateDuration {
 
                 // g. Let yearsMonthsWeeksLater be ? AddDate(calendar, plainRelativeTo, yearsMonthsWeeks, undefined, dateAdd).
                 let years_months_weeks_later =
-                    plain_relative_to.add_date(&years_months_weeks, None, context)?;
+                    cache.add_date(plain_relative_to, &years_months_weeks, context)?;
 
                 // h. Let weeksInDays be DaysUntil(yearsMonthsLater, yearsMonthsWeeksLater).
                 let weeks_in_days = years_months_later.days_until(&years_months_weeks_later);
@@ -640,7 +627,7 @@ impl DateDuration {
                 // n. Set plainRelativeTo to moveResult.[[RelativeTo]].
                 // o. Let oneMonthDays be moveResult.[[Days]].
                 let (mut plain_relative_to, mut one_month_days) =
-                    plain_relative_to.move_relative_date(&one_month, context)?;
+                    cache.move_relative_date(&plain_relative_to, &one_month, context)?;
 
                 let mut months = self.months;
                 // p. Repeat, while abs(fractionalDays) ≥ abs(oneMonthDays),
@@ -652,7 +639,8 @@ impl DateDuration {
                     fractional_days -= one_month_days;
 
                     // iii. Set moveResult to ? MoveRelativeDate(calendar, plainRelativeTo, oneMonth, dateAdd).
-                    let move_result = plain_relative_to.move_relative_date(&one_month, context)?;
+                    let move_result =
+                        cache.move_relative_date(&plain_relative_to, &one_month, context)?;
 
                     // iv. Set plainRelativeTo to moveResult.[[RelativeTo]].
                     plain_relative_to = move_result.0;
@@ -664,15 +652,12 @@ impl DateDuration {
                 let frac_months = months + fractional_days / one_month_days.abs();
 
                 // r. Set months to RoundNumberToIncrement(fractionalMonths, increment, roundingMode).
-                let rounded_months = IncrementRounder::<f64>::from_potentially_negative_parts(
-                    frac_months,
-                    increment.as_extended_increment(),
-                )?
-                .round(rounding_mode);
+                let rounded_months =
+                    round_number_to_increment(frac_months, increment, rounding_mode)?;
 
                 // s. Set total to fractionalMonths.
                 // t. Set weeks to 0.
-                let result = Self::new(self.years, rounded_months as f64, 0f64, 0f64)?;
+                let result = Self::new(self.years, rounded_months, 0f64, 0f64)?;
                 Ok((result, frac_months))
             }
             // 10. Else if unit is "week", then
@@ -695,7 +680,7 @@ impl DateDuration {
                 // g. Set plainRelativeTo to moveResult.[[RelativeTo]].
                 // h. Let oneWeekDays be moveResult.[[Days]].
                 let (mut plain_relative_to, mut one_week_days) =
-                    plain_relative_to.move_relative_date(&one_week, context)?;
+                    cache.move_relative_date(&plain_relative_to, &one_week, context)?;
 
                 let mut weeks = self.weeks;
                 // i. Repeat, while abs(fractionalDays) ≥ abs(oneWeekDays),
@@ -707,7 +692,8 @@ impl DateDuration {
                     fractional_days -= one_week_days;
 
                     // iii. Set moveResult to ? MoveRelativeDate(calendar, plainRelativeTo, oneWeek, dateAdd).
-                    let move_result = plain_relative_to.move_relative_date(&one_week, context)?;
+                    let move_result =
+                        cache.move_relative_date(&plain_relative_to, &one_week, context)?;
 
                     // iv. Set plainRelativeTo to moveResult.[[RelativeTo]].
                     plain_relative_to = move_result.0;
@@ -719,30 +705,42 @@ impl DateDuration {
                 let frac_weeks = weeks + fractional_days / one_week_days.abs();
 
                 // k. Set weeks to RoundNumberToIncrement(fractionalWeeks, increment, roundingMode).
-                let rounded_weeks = IncrementRounder::<f64>::from_potentially_negative_parts(
-                    frac_weeks,
-                    increment.as_extended_increment(),
-                )?
-                .round(rounding_mode);
+                let rounded_weeks =
+                    round_number_to_increment(frac_weeks, increment, rounding_mode)?;
                 // l. Set total to fractionalWeeks.
-                let result = Self::new(self.years, self.months, rounded_weeks as f64, 0f64)?;
+                let result = Self::new(self.years, self.months, rounded_weeks, 0f64)?;
                 Ok((result, frac_weeks))
             }
             // 11. Else if unit is "day", then
             TemporalUnit::Day => {
                 // a. Set days to RoundNumberToIncrement(fractionalDays, increment, roundingMode).
-                let rounded_days = IncrementRounder::<f64>::from_potentially_negative_parts(
-                    fractional_days,
-                    increment.as_extended_increment(),
-                )?
-                .round(rounding_mode);
+                let rounded_days =
+                    round_number_to_increment(fractional_days, increment, rounding_mode)?;
 
                 // b. Set total to fractionalDays.
                 // c. Set norm to ZeroTimeDuration().
-                let result = Self::new(self.years, self.months, self.weeks, rounded_days as f64)?;
+                let result = Self::new(self.years, self.months, self.weeks, rounded_days)?;
                 Ok((result, fractional_days))
             }
             _ => unreachable!("All other TemporalUnits were returned early as invalid."),
         }
     }
 }
+
+/// Rounds a fractional unit value to the provided increment.
+///
+/// NOTE: This is kept outside of the generic `DateDuration::round` so that it is only
+/// instantiated once.
+///
+/// Equivalent: `RoundNumberToIncrement`
+fn round_number_to_increment(
+    value: f64,
+    increment: RoundingIncrement,
+    rounding_mode: TemporalRoundingMode,
+) -> TemporalResult<f64> {
+    Ok(IncrementRounder::<f64>::from_potentially_negative_parts(
+        value,
+        increment.as_extended_increment(),
+    )?
+    .round(rounding_mode) as f64)
+}
@@ -59,6 +59,17 @@ impl NormalizedTimeDuration {
         self.0 / i128::from(divisor)
     }
 
+    /// Equivalent: 7.5.34 DivideNormalizedTimeDuration ( d, divisor )
+    ///
+    /// The division is computed on the integer quotient and remainder so that no
+    /// precision is lost prior to the final conversion to an `f64`.
+    #[inline]
+    pub(super) fn divide_exact(&self, divisor: u64) -> f64 {
+        let divisor = i128::from(divisor);
+        let (quotient, remainder) = (self.0 / divisor, self.0 % divisor);
+        quotient as f64 + remainder as f64 / divisor as f64
+    }
+
     // TODO: Use in algorithm update or remove.
     #[allow(unused)]
     pub(super) fn as_fractional_days(&self) -> f64 {
@@ -88,7 +99,7 @@ impl NormalizedTimeDuration {
     }
 
     /// Round the current `NormalizedTimeDuration`.
-    pub(super) fn round(
+    pub(crate) fn round(
         &self,
         increment: NonZeroU64,
         mode: TemporalRoundingMode,
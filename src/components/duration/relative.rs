@@ -0,0 +1,336 @@
+//! This module implements rounding of many `Duration`s relative to the same date.
+
+use std::{collections::VecDeque, hash::Hash};
+
+use rustc_hash::FxHashMap;
+
+use crate::{
+    components::{calendar::CalendarProtocol, tz::TzProtocol, Date},
+    iso::IsoDate,
+    options::{
+        ArithmeticOverflow, RelativeTo, RoundingIncrement, TemporalRoundingMode, TemporalUnit,
+    },
+    TemporalError, TemporalResult,
+};
+
+use super::{DateDuration, Duration};
+
+/// A context for rounding, totaling, and balancing many `Duration`s relative to the same
+/// `relativeTo` with the same rounding options.
+///
+/// The calendar operations that are performed relative to the `relativeTo` date, and to the
+/// dates that are reached from it, are cached for the lifetime of the `RoundingContext`, so
+/// the calendar is only called once for each distinct operation. As a result, the calendar
+/// methods of a `CalendarProtocol` must be pure for a `RoundingContext` to be used.
+///
+/// At most `RELATIVE_DATE_CACHE_CAPACITY` results of each operation are cached, evicting the
+/// oldest results first.
+pub struct RoundingContext<'a, C: CalendarProtocol, Z: TzProtocol> {
+    relative_to: RelativeTo<'a, C, Z>,
+    increment: Option<RoundingIncrement>,
+    smallest_unit: Option<TemporalUnit>,
+    largest_unit: Option<TemporalUnit>,
+    rounding_mode: Option<TemporalRoundingMode>,
+    cache: RelativeDateCache<C>,
+}
+
+impl<'a, C: CalendarProtocol, Z: TzProtocol> RoundingContext<'a, C, Z> {
+    /// Creates a new `RoundingContext` from a `relativeTo` and the options of
+    /// `Duration::round`.
+    pub fn new(
+        relative_to: RelativeTo<'a, C, Z>,
+        increment: Option<RoundingIncrement>,
+        smallest_unit: Option<TemporalUnit>,
+        largest_unit: Option<TemporalUnit>,
+        rounding_mode: Option<TemporalRoundingMode>,
+    ) -> TemporalResult<Self> {
+        if largest_unit.is_none() && smallest_unit.is_none() {
+            return Err(TemporalError::range()
+                .with_message("smallestUnit and largestUnit cannot both be None."));
+        }
+        if relative_to.zdt.is_some() {
+            return Err(TemporalError::general("Not yet implemented."));
+        }
+
+        Ok(Self {
+            relative_to,
+            increment,
+            smallest_unit,
+            largest_unit,
+            rounding_mode,
+            cache: RelativeDateCache::enabled(),
+        })
+    }
+
+    /// Rounds a `Duration` with the options of this `RoundingContext`.
+    ///
+    /// Equivalent to `Duration::round`.
+    pub fn round(
+        &mut self,
+        duration: &Duration,
+        context: &mut C::Context,
+    ) -> TemporalResult<Duration> {
+        duration.round_with_cache(
+            self.increment,
+            self.smallest_unit,
+            self.largest_unit,
+            self.rounding_mode,
+            &self.relative_to,
+            &mut self.cache,
+            context,
+        )
+    }
+
+    /// Rounds a slice of `Duration`s with the options of this `RoundingContext`.
+    pub fn round_all(
+        &mut self,
+        durations: &[Duration],
+        context: &mut C::Context,
+    ) -> TemporalResult<Vec<Duration>> {
+        durations
+            .iter()
+            .map(|duration| self.round(duration, context))
+            .collect()
+    }
+
+    /// Balances a `Duration` up to the `largestUnit` of this `RoundingContext` without rounding.
+    ///
+    /// Equivalent to `Duration::round` with a `smallestUnit` of "nanosecond" and an increment
+    /// of one.
+    pub fn balance(
+        &mut self,
+        duration: &Duration,
+        context: &mut C::Context,
+    ) -> TemporalResult<Duration> {
+        duration.round_with_cache(
+            None,
+            None,
+            Some(self.largest_unit.unwrap_or(TemporalUnit::Auto)),
+            None,
+            &self.relative_to,
+            &mut self.cache,
+            context,
+        )
+    }
+
+    /// Returns the total of a `Duration` in the provided `TemporalUnit`.
+    ///
+    /// Equivalent to `Duration::total`.
+    pub fn total(
+        &mut self,
+        duration: &Duration,
+        unit: TemporalUnit,
+        context: &mut C::Context,
+    ) -> TemporalResult<f64> {
+        duration.total_with_cache(unit, &self.relative_to, &mut self.cache, context)
+    }
+
+    /// Returns the totals of a slice of `Duration`s in the provided `TemporalUnit`.
+    pub fn total_all(
+        &mut self,
+        durations: &[Duration],
+        unit: TemporalUnit,
+        context: &mut C::Context,
+    ) -> TemporalResult<Vec<f64>> {
+        durations
+            .iter()
+            .map(|duration| self.total(duration, unit, context))
+            .collect()
+    }
+}
+
+// ==== RelativeDateCache ====
+
+/// The maximum number of results of each calendar operation held by a `RoundingContext`.
+pub const RELATIVE_DATE_CACHE_CAPACITY: usize = 1024;
+
+/// The key of a date duration added to an `IsoDate`.
+type AddKey = (IsoDate, [u64; 4]);
+
+/// A map that holds at most `RELATIVE_DATE_CACHE_CAPACITY` entries, evicting the oldest
+/// entries first.
+struct BoundedMap<K, V> {
+    entries: FxHashMap<K, V>,
+    /// The keys of `entries` in insertion order.
+    order: VecDeque<K>,
+}
+
+impl<K: Copy + Eq + Hash, V> BoundedMap<K, V> {
+    fn new() -> Self {
+        Self {
+            entries: FxHashMap::default(),
+            order: VecDeque::new(),
+        }
+    }
+
+    fn get(&self, key: &K) -> Option<&V> {
+        self.entries.get(key)
+    }
+
+    fn insert(&mut self, key: K, value: V) {
+        if self.entries.insert(key, value).is_none() {
+            self.order.push_back(key);
+        }
+        while self.order.len() > RELATIVE_DATE_CACHE_CAPACITY {
+            if let Some(key) = self.order.pop_front() {
+                self.entries.remove(&key);
+            }
+        }
+    }
+}
+
+/// A cache of the calendar operations that are performed while rounding relative to a date.
+///
+/// A disabled cache forwards every operation to the calendar.
+pub(crate) struct RelativeDateCache<C: CalendarProtocol> {
+    enabled: bool,
+    added: BoundedMap<AddKey, Date<C>>,
+    differences: BoundedMap<(IsoDate, IsoDate, TemporalUnit), Duration>,
+}
+
+impl<C: CalendarProtocol> RelativeDateCache<C> {
+    /// Creates a `RelativeDateCache` that does not cache any operation.
+    pub(crate) fn disabled() -> Self {
+        Self {
+            enabled: false,
+            added: BoundedMap::new(),
+            differences: BoundedMap::new(),
+        }
+    }
+
+    /// Creates a `RelativeDateCache` that caches every calendar operation.
+    pub(crate) fn enabled() -> Self {
+        Self {
+            enabled: true,
+            ..Self::disabled()
+        }
+    }
+
+    /// Returns the key of a `Duration` added to `date`, or `None` if the `Duration` has time
+    /// units.
+    fn add_key(date: &Date<C>, duration: &Duration) -> Option<AddKey> {
+        if duration.time().to_normalized().0 != 0 {
+            return None;
+        }
+        let DateDuration {
+            years,
+            months,
+            weeks,
+            days,
+        } = *duration.date();
+        Some((date.iso, [years, months, weeks, days].map(f64::to_bits)))
+    }
+
+    /// Equivalent: `CalendarDateAdd ( calendarRec, plainDate, duration, "constrain" )`
+    pub(crate) fn calendar_date_add(
+        &mut self,
+        date: &Date<C>,
+        duration: &Duration,
+        context: &mut C::Context,
+    ) -> TemporalResult<Date<C>> {
+        let key = match Self::add_key(date, duration) {
+            Some(key) if self.enabled => key,
+            _ => {
+                return date.calendar().date_add(
+                    date,
+                    duration,
+                    ArithmeticOverflow::Constrain,
+                    context,
+                )
+            }
+        };
+        if let Some(result) = self.added.get(&key) {
+            return Ok(result.clone());
+        }
+        let result =
+            date.calendar()
+                .date_add(date, duration, ArithmeticOverflow::Constrain, context)?;
+        self.added.insert(key, result.clone());
+        Ok(result)
+    }
+
+    /// Equivalent: `CalendarDateAddDurations` with an overflow of "constrain".
+    pub(crate) fn calendar_date_add_durations(
+        &mut self,
+        date: &Date<C>,
+        durations: &[Duration],
+        context: &mut C::Context,
+    ) -> TemporalResult<Vec<Date<C>>> {
+        if !self.enabled {
+            return date.calendar().date_add_durations(
+                date,
+                durations,
+                ArithmeticOverflow::Constrain,
+                context,
+            );
+        }
+        durations
+            .iter()
+            .map(|duration| self.calendar_date_add(date, duration, context))
+            .collect()
+    }
+
+    /// Equivalent: `AddDate ( calendarRec, plainDate, duration )`
+    pub(crate) fn add_date(
+        &mut self,
+        date: &Date<C>,
+        duration: &Duration,
+        context: &mut C::Context,
+    ) -> TemporalResult<Date<C>> {
+        let date_units = duration.date();
+        // NOTE: Only calendar units require a call to the calendar.
+        if !self.enabled
+            || (date_units.years == 0.0 && date_units.months == 0.0 && date_units.weeks == 0.0)
+        {
+            return date.add_date(duration, None, context);
+        }
+        self.calendar_date_add(date, duration, context)
+    }
+
+    /// Equivalent: `MoveRelativeDate ( calendarRec, relativeTo, duration )`
+    pub(crate) fn move_relative_date(
+        &mut self,
+        date: &Date<C>,
+        duration: &Duration,
+        context: &mut C::Context,
+    ) -> TemporalResult<(Date<C>, f64)> {
+        let new_date = self.add_date(date, duration, context)?;
+        let days = f64::from(date.days_until(&new_date));
+        Ok((new_date, days))
+    }
+
+    /// Equivalent: `CalendarDateUntil ( calendarRec, one, two, largestUnit )`
+    pub(crate) fn date_until(
+        &mut self,
+        one: &Date<C>,
+        two: &Date<C>,
+        largest_unit: TemporalUnit,
+        context: &mut C::Context,
+    ) -> TemporalResult<Duration> {
+        if !self.enabled {
+            return one.calendar().date_until(one, two, largest_unit, context);
+        }
+        let key = (one.iso, two.iso, largest_unit);
+        if let Some(result) = self.differences.get(&key) {
+            return Ok(*result);
+        }
+        let result = one.calendar().date_until(one, two, largest_unit, context)?;
+        self.differences.insert(key, result);
+        Ok(result)
+    }
+
+    /// Equivalent: `DifferenceDate ( calendarRec, one, two, largestUnit )`
+    pub(crate) fn diff_date(
+        &mut self,
+        one: &Date<C>,
+        two: &Date<C>,
+        largest_unit: TemporalUnit,
+        context: &mut C::Context,
+    ) -> TemporalResult<Duration> {
+        // NOTE: Equal dates and a largest unit of "day" do not require a call to the calendar.
+        if !self.enabled || one.iso == two.iso || largest_unit == TemporalUnit::Day {
+            return one.internal_diff_date(two, largest_unit, context);
+        }
+        self.date_until(one, two, largest_unit, context)
+    }
+}
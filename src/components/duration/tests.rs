@@ -1,6 +1,12 @@
+use tinystr::TinyAsciiStr;
+
 use crate::{
-    components::{calendar::CalendarSlot, Date},
+    components::{
+        calendar::{CalendarDateLike, CalendarSlot},
+        Date, DateTime, MonthDay, YearMonth,
+    },
     options::ArithmeticOverflow,
+    TemporalFields,
 };
 
 use super::*;
@@ -666,3 +672,614 @@ fn rounding_increment_non_integer() {
         &[0.0, 0.0, 0.0, 1e9, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0]
     );
 }
+
+#[test]
+fn total_time_units_without_relative_to() {
+    let relative_to = RelativeTo::<'_, (), ()> {
+        date: None,
+        zdt: None,
+    };
+
+    let duration = Duration::from_str("PT90M").unwrap();
+    assert_eq!(
+        duration
+            .total(TemporalUnit::Hour, &relative_to, &mut ())
+            .unwrap(),
+        1.5
+    );
+    assert_eq!(
+        duration
+            .total(TemporalUnit::Second, &relative_to, &mut ())
+            .unwrap(),
+        5400.0
+    );
+
+    let duration = Duration::from_str("-P1DT12H").unwrap();
+    assert_eq!(
+        duration
+            .total(TemporalUnit::Hour, &relative_to, &mut ())
+            .unwrap(),
+        -36.0
+    );
+    assert_eq!(
+        duration
+            .total(TemporalUnit::Day, &relative_to, &mut ())
+            .unwrap(),
+        -1.5
+    );
+
+    // Calendar units require a relativeTo.
+    assert!(duration
+        .total(TemporalUnit::Month, &relative_to, &mut ())
+        .is_err());
+    assert!(Duration::from_str("P1M")
+        .unwrap()
+        .total(TemporalUnit::Hour, &relative_to, &mut ())
+        .is_err());
+}
+
+#[test]
+fn total_with_relative_to() {
+    let total = |duration: &str, unit: TemporalUnit, relative: &str| {
+        let date = Date::<()>::from_str(relative).unwrap();
+        let relative_to = RelativeTo::<'_, (), ()> {
+            date: Some(&date),
+            zdt: None,
+        };
+        Duration::from_str(duration)
+            .unwrap()
+            .total(unit, &relative_to, &mut ())
+            .unwrap()
+    };
+
+    assert_eq!(total("P1M", TemporalUnit::Day, "2020-02-01"), 29.0);
+    assert_eq!(total("P1MT12H", TemporalUnit::Hour, "2020-02-01"), 708.0);
+
+    assert_eq!(
+        total("P1Y6M", TemporalUnit::Year, "2020-01-01"),
+        1.0 + 181.0 / 365.0
+    );
+    assert_eq!(total("P1Y6M", TemporalUnit::Month, "2020-01-01"), 18.0);
+    assert_eq!(
+        total("P1M15D", TemporalUnit::Month, "2020-02-01"),
+        1.0 + 15.0 / 31.0
+    );
+    assert_eq!(
+        total("-P1M15D", TemporalUnit::Month, "2020-03-16"),
+        -1.0 - 15.0 / 31.0
+    );
+    assert_eq!(
+        total("P10D", TemporalUnit::Week, "2020-01-01"),
+        1.0 + 3.0 / 7.0
+    );
+
+    // A negative time remainder that ends just past a month boundary.
+    assert_eq!(
+        total("-P27DT23H", TemporalUnit::Month, "2021-03-01"),
+        -671.0 / 672.0
+    );
+}
+
+/// An ISO 8601 `CalendarProtocol` that counts its calls to `dateAdd` and `dateUntil` in its
+/// context.
+#[derive(Debug, Clone)]
+struct CountingCalendar;
+
+impl CountingCalendar {
+    fn iso() -> CalendarSlot<Self> {
+        CalendarSlot::iso()
+    }
+}
+
+impl CalendarProtocol for CountingCalendar {
+    type Date = Date<Self>;
+    type DateTime = DateTime<Self>;
+    type YearMonth = YearMonth<Self>;
+    type MonthDay = MonthDay<Self>;
+    type Context = usize;
+
+    fn date_from_fields(
+        &self,
+        _: &mut TemporalFields,
+        _: ArithmeticOverflow,
+        _: &mut usize,
+    ) -> TemporalResult<Date<Self>> {
+        unreachable!()
+    }
+
+    fn year_month_from_fields(
+        &self,
+        _: &mut TemporalFields,
+        _: ArithmeticOverflow,
+        _: &mut usize,
+    ) -> TemporalResult<YearMonth<Self>> {
+        unreachable!()
+    }
+
+    fn month_day_from_fields(
+        &self,
+        _: &mut TemporalFields,
+        _: ArithmeticOverflow,
+        _: &mut usize,
+    ) -> TemporalResult<MonthDay<Self>> {
+        unreachable!()
+    }
+
+    fn date_add(
+        &self,
+        date: &Date<Self>,
+        duration: &Duration,
+        overflow: ArithmeticOverflow,
+        calls: &mut usize,
+    ) -> TemporalResult<Date<Self>> {
+        *calls += 1;
+        let result = Self::iso().date_add(date, duration, overflow, calls)?;
+        Ok(Date::new_unchecked(
+            result.iso,
+            CalendarSlot::Protocol(self.clone()),
+        ))
+    }
+
+    fn date_until(
+        &self,
+        one: &Date<Self>,
+        two: &Date<Self>,
+        largest_unit: TemporalUnit,
+        calls: &mut usize,
+    ) -> TemporalResult<Duration> {
+        *calls += 1;
+        Self::iso().date_until(one, two, largest_unit, calls)
+    }
+
+    fn era(
+        &self,
+        date_like: &CalendarDateLike<Self>,
+        calls: &mut usize,
+    ) -> TemporalResult<Option<TinyAsciiStr<16>>> {
+        Self::iso().era(date_like, calls)
+    }
+
+    fn era_year(
+        &self,
+        date_like: &CalendarDateLike<Self>,
+        calls: &mut usize,
+    ) -> TemporalResult<Option<i32>> {
+        Self::iso().era_year(date_like, calls)
+    }
+
+    fn year(&self, date_like: &CalendarDateLike<Self>, calls: &mut usize) -> TemporalResult<i32> {
+        Self::iso().year(date_like, calls)
+    }
+
+    fn month(&self, date_like: &CalendarDateLike<Self>, calls: &mut usize) -> TemporalResult<u8> {
+        Self::iso().month(date_like, calls)
+    }
+
+    fn month_code(
+        &self,
+        date_like: &CalendarDateLike<Self>,
+        calls: &mut usize,
+    ) -> TemporalResult<TinyAsciiStr<4>> {
+        Self::iso().month_code(date_like, calls)
+    }
+
+    fn day(&self, date_like: &CalendarDateLike<Self>, calls: &mut usize) -> TemporalResult<u8> {
+        Self::iso().day(date_like, calls)
+    }
+
+    fn day_of_week(
+        &self,
+        date_like: &CalendarDateLike<Self>,
+        calls: &mut usize,
+    ) -> TemporalResult<u16> {
+        Self::iso().day_of_week(date_like, calls)
+    }
+
+    fn day_of_year(
+        &self,
+        date_like: &CalendarDateLike<Self>,
+        calls: &mut usize,
+    ) -> TemporalResult<u16> {
+        Self::iso().day_of_year(date_like, calls)
+    }
+
+    fn week_of_year(
+        &self,
+        date_like: &CalendarDateLike<Self>,
+        calls: &mut usize,
+    ) -> TemporalResult<u16> {
+        Self::iso().week_of_year(date_like, calls)
+    }
+
+    fn year_of_week(
+        &self,
+        date_like: &CalendarDateLike<Self>,
+        calls: &mut usize,
+    ) -> TemporalResult<i32> {
+        Self::iso().year_of_week(date_like, calls)
+    }
+
+    fn days_in_week(
+        &self,
+        date_like: &CalendarDateLike<Self>,
+        calls: &mut usize,
+    ) -> TemporalResult<u16> {
+        Self::iso().days_in_week(date_like, calls)
+    }
+
+    fn days_in_month(
+        &self,
+        date_like: &CalendarDateLike<Self>,
+        calls: &mut usize,
+    ) -> TemporalResult<u16> {
+        Self::iso().days_in_month(date_like, calls)
+    }
+
+    fn days_in_year(
+        &self,
+        date_like: &CalendarDateLike<Self>,
+        calls: &mut usize,
+    ) -> TemporalResult<u16> {
+        Self::iso().days_in_year(date_like, calls)
+    }
+
+    fn months_in_year(
+        &self,
+        date_like: &CalendarDateLike<Self>,
+        calls: &mut usize,
+    ) -> TemporalResult<u16> {
+        Self::iso().months_in_year(date_like, calls)
+    }
+
+    fn in_leap_year(
+        &self,
+        date_like: &CalendarDateLike<Self>,
+        calls: &mut usize,
+    ) -> TemporalResult<bool> {
+        Self::iso().in_leap_year(date_like, calls)
+    }
+
+    fn fields(&self, _: Vec<String>, _: &mut usize) -> TemporalResult<Vec<String>> {
+        unreachable!()
+    }
+
+    fn merge_fields(
+        &self,
+        _: &TemporalFields,
+        _: &TemporalFields,
+        _: &mut usize,
+    ) -> TemporalResult<TemporalFields> {
+        unreachable!()
+    }
+
+    fn identifier(&self, _: &mut usize) -> TemporalResult<String> {
+        Ok(String::from("counting"))
+    }
+}
+
+#[test]
+fn rounding_context_matches_duration() {
+    let date = Date::<()>::from_str("2020-01-31").unwrap();
+    let durations = [
+        "P1Y2M10DT5H",
+        "P3M",
+        "P5W3D",
+        "P40D",
+        "PT30H",
+        "-P1M15D",
+        "-P2Y3W",
+    ]
+    .map(|duration| Duration::from_str(duration).unwrap());
+
+    let fields = |result: TemporalResult<Duration>| result.ok().map(|duration| duration.fields());
+    let relative_to = || RelativeTo::<'_, (), ()> {
+        date: Some(&date),
+        zdt: None,
+    };
+
+    for unit in [
+        TemporalUnit::Year,
+        TemporalUnit::Month,
+        TemporalUnit::Week,
+        TemporalUnit::Day,
+        TemporalUnit::Hour,
+    ] {
+        let mut context =
+            RoundingContext::new(relative_to(), None, Some(unit), None, None).unwrap();
+        // Each `Duration` is run twice to read back the cached calendar operations.
+        for duration in durations.iter().chain(durations.iter()) {
+            assert_eq!(
+                fields(context.round(duration, &mut ())),
+                fields(duration.round(None, Some(unit), None, None, &relative_to(), &mut ())),
+            );
+            assert_eq!(
+                context.total(duration, unit, &mut ()).ok(),
+                duration.total(unit, &relative_to(), &mut ()).ok(),
+            );
+        }
+    }
+
+    let mut context =
+        RoundingContext::new(relative_to(), None, None, Some(TemporalUnit::Year), None).unwrap();
+    let balanced = context.round_all(&durations, &mut ()).unwrap();
+    for (duration, balanced) in durations.iter().zip(balanced) {
+        let expected = duration
+            .round(
+                None,
+                None,
+                Some(TemporalUnit::Year),
+                None,
+                &relative_to(),
+                &mut (),
+            )
+            .unwrap();
+        assert_eq!(balanced.fields(), expected.fields());
+        assert_eq!(
+            context.balance(duration, &mut ()).unwrap().fields(),
+            expected.fields()
+        );
+    }
+
+    assert!(RoundingContext::new(relative_to(), None, None, None, None).is_err());
+
+    // The context calls the calendar less often than rounding each `Duration` on its own.
+    let counting_date = Date::new_unchecked(date.iso, CalendarSlot::Protocol(CountingCalendar));
+    let relative_to = || RelativeTo::<'_, CountingCalendar, ()> {
+        date: Some(&counting_date),
+        zdt: None,
+    };
+    for unit in [TemporalUnit::Year, TemporalUnit::Month] {
+        let mut uncached_calls = 0;
+        let mut cached_calls = 0;
+        let mut context =
+            RoundingContext::new(relative_to(), None, Some(unit), None, None).unwrap();
+        for duration in durations.iter().chain(durations.iter()) {
+            let expected = duration.round(
+                None,
+                Some(unit),
+                None,
+                None,
+                &relative_to(),
+                &mut uncached_calls,
+            );
+            assert_eq!(
+                fields(context.round(duration, &mut cached_calls)),
+                fields(expected)
+            );
+        }
+        assert!(uncached_calls > 0);
+        assert!(
+            cached_calls < uncached_calls,
+            "{unit:?}: {cached_calls} calls with the context, {uncached_calls} without"
+        );
+    }
+}
+
+#[test]
+fn compare_durations() {
+    let duration = |s: &str| Duration::from_str(s).unwrap();
+    let no_relative_to = RelativeTo::<'_, (), ()> {
+        date: None,
+        zdt: None,
+    };
+
+    // Time units and days are compared exactly without a relativeTo.
+    let compare = |one: &str, two: &str| {
+        duration(one)
+            .compare(&duration(two), &no_relative_to, &mut ())
+            .unwrap()
+    };
+    assert_eq!(compare("PT90M", "PT1H30M"), Ordering::Equal);
+    assert_eq!(compare("P1D", "PT23H59M59.999999999S"), Ordering::Greater);
+    assert_eq!(compare("-PT1S", "PT0S"), Ordering::Less);
+    assert_eq!(compare("P1M", "P1M"), Ordering::Equal);
+    assert!(duration("P1M")
+        .compare(&duration("P30D"), &no_relative_to, &mut ())
+        .is_err());
+
+    let date = Date::<()>::from_str("2020-02-01").unwrap();
+    let relative_to = RelativeTo::<'_, (), ()> {
+        date: Some(&date),
+        zdt: None,
+    };
+    let compare_relative = |one: &str, two: &str| {
+        duration(one)
+            .compare(&duration(two), &relative_to, &mut ())
+            .unwrap()
+    };
+    assert_eq!(compare_relative("P1M", "P29D"), Ordering::Equal);
+    assert_eq!(compare_relative("P1M", "P30D"), Ordering::Less);
+    assert_eq!(compare_relative("P1Y", "P365D"), Ordering::Greater);
+
+    let mut durations = ["P1M", "PT700H", "P29D", "-P1W", "P1Y", "PT1S"].map(duration);
+    Duration::sort(&mut durations, &relative_to, &mut ()).unwrap();
+    let sorted = durations.map(|duration| duration.fields());
+    let expected = ["-P1W", "PT1S", "P1M", "P29D", "PT700H", "P1Y"].map(|s| duration(s).fields());
+    assert_eq!(sorted, expected);
+}
+
+#[test]
+fn duration_from_str() {
+    let fields = |s: &str| Duration::from_str(s).unwrap().fields();
+
+    assert_eq!(
+        fields("-P1Y2M3W4DT5H6M7.123456789S"),
+        [-1.0, -2.0, -3.0, -4.0, -5.0, -6.0, -7.0, -123.0, -456.0, -789.0]
+    );
+    assert_eq!(fields("p1y2m3w4dt5h6m7s"), fields("P1Y2M3W4DT5H6M7S"));
+    assert_eq!(fields("+PT1,5S"), fields("PT1.5S"));
+    assert_eq!(fields("\u{2212}P1D"), fields("-P1D"));
+
+    // Fractional hours and minutes are converted into exact nanoseconds.
+    assert_eq!(
+        fields("PT1.000000001H"),
+        [0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 3.0, 600.0]
+    );
+    assert_eq!(
+        fields("PT0.123456789M"),
+        [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 7.0, 407.0, 407.0, 340.0]
+    );
+    assert_eq!(fields("PT9007199254740991S")[6], 9_007_199_254_740_991.0);
+
+    for invalid in [
+        "",
+        "P",
+        "PT",
+        "P1DT",
+        "1D",
+        "P1",
+        "P1.5D",
+        "PT1.5H2M",
+        "PT1.S",
+        "PT0.1234567890S",
+        "P1D1Y",
+        "P1Y1Y",
+        "PT1H1D",
+        "P1DTT1H",
+        "P-1D",
+        "PT1H ",
+        "PT9007199254740992S",
+    ] {
+        assert!(Duration::from_str(invalid).is_err(), "{invalid}");
+    }
+}
+
+#[test]
+fn duration_to_string() {
+    let to_string = |s: &str| Duration::from_str(s).unwrap().to_string();
+
+    assert_eq!(
+        to_string("P1Y2M3W4DT5H6M7.123456789S"),
+        "P1Y2M3W4DT5H6M7.123456789S"
+    );
+    assert_eq!(to_string("-PT1.5S"), "-PT1.5S");
+    assert_eq!(to_string("PT0S"), "PT0S");
+    assert_eq!(to_string("-P0D"), "PT0S");
+    assert_eq!(to_string("P1D"), "P1D");
+    assert_eq!(to_string("PT0.000001S"), "PT0.000001S");
+    assert_eq!(to_string("PT1.5H"), "PT1H30M");
+
+    // The subsecond units are balanced into the seconds.
+    let duration = Duration::new(0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 59.0, 1500.0, 0.0, 1.0).unwrap();
+    assert_eq!(duration.to_string(), "PT1M60.500000001S");
+
+    let mut buffer = String::with_capacity(32);
+    Duration::from_str("P1Y")
+        .unwrap()
+        .write_to(&mut buffer)
+        .unwrap();
+    assert_eq!(buffer, "P1Y");
+
+    // Seconds past the maximum safe integer are still balanced exactly.
+    let seconds = |seconds: f64, milliseconds: f64| {
+        Duration::new(
+            0.0,
+            0.0,
+            0.0,
+            0.0,
+            0.0,
+            0.0,
+            seconds,
+            milliseconds,
+            0.0,
+            0.0,
+        )
+        .unwrap()
+        .to_string()
+    };
+    let max_seconds = 9_007_199_254_740_991.0;
+    assert_eq!(seconds(-max_seconds, -999.0), "-PT9007199254740991.999S");
+    assert_eq!(seconds(max_seconds, 1000.0), "PT9007199254740992S");
+    assert_eq!(seconds(1e20, 0.0), "PT100000000000000000000S");
+    // 2^120 milliseconds do not fit an `i128` once balanced into nanoseconds.
+    assert_eq!(
+        seconds(0.0, 2f64.powi(120)),
+        "PT1329227995784915872903807060280344.576S"
+    );
+}
+
+/// A xorshift generator for deterministic property tests.
+struct XorShift(u64);
+
+impl XorShift {
+    fn next(&mut self) -> u64 {
+        self.0 ^= self.0 << 13;
+        self.0 ^= self.0 >> 7;
+        self.0 ^= self.0 << 17;
+        self.0
+    }
+
+    /// Returns zero for roughly a third of values, and otherwise a value below `max`.
+    fn field(&mut self, max: u64) -> u64 {
+        match self.next() % 3 {
+            0 => 0,
+            _ => self.next() % max,
+        }
+    }
+}
+
+#[test]
+fn duration_string_round_trip() {
+    let mut rng = XorShift(0x2545_f491_4f6c_dd1d);
+    let subsecond_nanoseconds = |d: &Duration| {
+        d.seconds() as i128 * 1_000_000_000
+            + d.milliseconds() as i128 * 1_000_000
+            + d.microseconds() as i128 * 1_000
+            + d.nanoseconds() as i128
+    };
+
+    for _ in 0..10_000 {
+        let sign = if rng.next() % 2 == 0 { 1.0 } else { -1.0 };
+        let mut field = |max: u64| rng.field(max) as f64 * sign;
+        let duration = Duration::new(
+            field(1 << 32),
+            field(1 << 32),
+            field(1 << 32),
+            field(1 << 40),
+            field(1 << 44),
+            field(1 << 46),
+            field(1 << 50),
+            field(1 << 50),
+            field(1 << 50),
+            field(1 << 50),
+        )
+        .unwrap();
+
+        // Formatting and parsing preserves the value of the `Duration`.
+        let formatted = duration.to_string();
+        let parsed = Duration::from_str(&formatted).unwrap();
+        assert_eq!(parsed.fields()[..6], duration.fields()[..6], "{formatted}");
+        assert_eq!(
+            subsecond_nanoseconds(&parsed),
+            subsecond_nanoseconds(&duration),
+            "{formatted}"
+        );
+        // The canonical string is a fixed point.
+        assert_eq!(parsed.to_string(), formatted);
+    }
+
+    // Fractional hours and minutes parse into exact nanoseconds.
+    for _ in 0..10_000 {
+        let whole = rng.next() % (1 << 40);
+        let digits = (rng.next() % 9 + 1) as u32;
+        let fraction = rng.next() % 10u64.pow(digits);
+        let (designator, unit_seconds) = if rng.next() % 2 == 0 {
+            ('H', 3600)
+        } else {
+            ('M', 60)
+        };
+        let source = format!(
+            "PT{whole}.{fraction:0width$}{designator}",
+            width = digits as usize
+        );
+
+        let parsed = Duration::from_str(&source).unwrap();
+        let expected = (i128::from(whole) * 1_000_000_000
+            + i128::from(fraction) * 10i128.pow(9 - digits))
+            * unit_seconds;
+        let total = parsed.hours() as i128 * 3_600_000_000_000
+            + parsed.minutes() as i128 * 60_000_000_000
+            + subsecond_nanoseconds(&parsed);
+        assert_eq!(total, expected, "{source}");
+    }
+}
@@ -1,17 +1,27 @@
 //! An implementation of the Temporal Instant.
 
-use std::num::NonZeroU64;
+use std::{num::NonZeroU64, str::FromStr};
 
 use crate::{
     components::{duration::TimeDuration, Duration},
     options::{RoundingIncrement, TemporalRoundingMode, TemporalUnit},
+    parsers::{parse_instant, utc_offset_nanoseconds},
     rounding::{IncrementRounder, Round},
-    TemporalError, TemporalResult, TemporalUnwrap, MS_PER_DAY, NS_PER_DAY,
+    utils, TemporalError, TemporalResult, TemporalUnwrap, MS_PER_DAY, NS_MAX_INSTANT,
+    NS_MIN_INSTANT, NS_PER_DAY,
 };
 
 use num_bigint::BigInt;
 use num_traits::{FromPrimitive, ToPrimitive};
 
+mod codec;
+mod interval;
+
+#[doc(inline)]
+pub use codec::{InstantColumn, INSTANT_COLUMN_BLOCK_LEN};
+#[doc(inline)]
+pub use interval::{InstantInterval, IntervalIndex};
+
 const NANOSECONDS_PER_SECOND: f64 = 1e9;
 const NANOSECONDS_PER_MINUTE: f64 = 60f64 * NANOSECONDS_PER_SECOND;
 const NANOSECONDS_PER_HOUR: f64 = 60f64 * NANOSECONDS_PER_MINUTE;
@@ -296,6 +306,57 @@ impl Instant {
     }
 }
 
+// ==== Trait impls ====
+
+impl FromStr for Instant {
+    type Err = TemporalError;
+
+    fn from_str(s: &str) -> Result<Self, Self::Err> {
+        let record = parse_instant(s)?;
+
+        let date = record.date.temporal_unwrap()?;
+        let time = record.time.temporal_unwrap()?;
+        let offset = record.offset.temporal_unwrap()?;
+
+        if date.month == 0
+            || date.day == 0
+            || date.day > utils::gregorian_days_in_month(date.year, date.month)
+        {
+            return Err(
+                TemporalError::range().with_message("Instant string contains an invalid date.")
+            );
+        }
+
+        // NOTE: A leap second is constrained to the last second of the minute.
+        let second = time.second.min(59);
+        if time.hour > 23 || time.minute > 59 || time.nanosecond > 999_999_999 {
+            return Err(
+                TemporalError::range().with_message("Instant string contains an invalid time.")
+            );
+        }
+
+        // NOTE: Instant strings are converted to epoch nanoseconds directly with the
+        // integer civil day kernel rather than building an `IsoDateTime` first.
+        let epoch_days = utils::epoch_days_from_gregorian_date(date.year, date.month, date.day);
+        let time_nanos = i128::from(time.hour) * NANOSECONDS_PER_HOUR as i128
+            + i128::from(time.minute) * NANOSECONDS_PER_MINUTE as i128
+            + i128::from(second) * NANOSECONDS_PER_SECOND as i128
+            + i128::from(time.nanosecond);
+        let offset_nanos = utc_offset_nanoseconds(&offset);
+
+        let nanos = i128::from(epoch_days) * i128::from(NS_PER_DAY) + time_nanos - offset_nanos;
+
+        if !(NS_MIN_INSTANT..=NS_MAX_INSTANT).contains(&nanos) {
+            return Err(TemporalError::range()
+                .with_message("Instant nanoseconds are not within a valid epoch range."));
+        }
+
+        Ok(Self {
+            nanos: BigInt::from(nanos),
+        })
+    }
+}
+
 // ==== Utility Functions ====
 
 /// Utility for determining if the nanos are within a valid range.
@@ -309,7 +370,11 @@ pub(crate) fn is_valid_epoch_nanos(nanos: &BigInt) -> bool {
 
 #[cfg(test)]
 mod tests {
-    use crate::{components::Instant, NS_MAX_INSTANT, NS_MIN_INSTANT};
+    use std::str::FromStr;
+
+    use crate::{
+        components::Instant, error::ErrorKind, iso::IsoDateTime, NS_MAX_INSTANT, NS_MIN_INSTANT,
+    };
     use num_bigint::BigInt;
     use num_traits::ToPrimitive;
 
@@ -332,4 +397,106 @@ mod tests {
         assert!(Instant::new(max_plus_one).is_err());
         assert!(Instant::new(min_minus_one).is_err());
     }
+
+    #[test]
+    fn instant_from_str_basic() {
+        let epoch = Instant::from_str("1970-01-01T00:00Z").unwrap();
+        assert_eq!(epoch.nanos, BigInt::from(0));
+
+        let instant = Instant::from_str("1969-12-31T23:59:59.999999999Z").unwrap();
+        assert_eq!(instant.nanos, BigInt::from(-1));
+
+        let instant = Instant::from_str("2020-02-29T12:30:15.123456789+05:30").unwrap();
+        let utc = Instant::from_str("2020-02-29T07:00:15.123456789Z").unwrap();
+        assert_eq!(instant, utc);
+        assert_eq!(utc.nanos, BigInt::from(1_582_959_615_123_456_789i64));
+
+        // Leap seconds are constrained.
+        let leap = Instant::from_str("2016-12-31T23:59:60Z").unwrap();
+        let constrained = Instant::from_str("2016-12-31T23:59:59Z").unwrap();
+        assert_eq!(leap, constrained);
+    }
+
+    #[test]
+    fn instant_from_str_limits() {
+        let max = Instant::from_str("+275760-09-13T00:00Z").unwrap();
+        assert_eq!(max.nanos, BigInt::from(NS_MAX_INSTANT));
+        let min = Instant::from_str("-271821-04-20T00:00Z").unwrap();
+        assert_eq!(min.nanos, BigInt::from(NS_MIN_INSTANT));
+
+        assert!(Instant::from_str("+275760-09-13T00:00:00.000000001Z").is_err());
+        assert!(Instant::from_str("-271821-04-19T23:59:59.999999999Z").is_err());
+        // The offset may bring an out of range date time back into range.
+        assert!(Instant::from_str("-271821-04-19T23:00-01:00").is_ok());
+    }
+
+    #[test]
+    fn instant_from_str_invalid() {
+        let invalid_strings = [
+            "2020-01-01",
+            "2020-01-01T00:00",
+            "2020-02-30T00:00Z",
+            "2020-13-01T00:00Z",
+            "2020-01-01T24:00Z",
+        ];
+
+        for s in invalid_strings {
+            assert!(Instant::from_str(s).is_err(), "{s} should not parse.");
+        }
+
+        // Malformed strings are reported as syntax errors.
+        let err = Instant::from_str("bad").unwrap_err();
+        assert_eq!(err.kind(), ErrorKind::Syntax);
+    }
+
+    #[test]
+    fn instant_from_str_matches_iso_date_time() {
+        // Compare the direct conversion against the `IsoDateTime` conversion.
+        let test_strings = [
+            ("1970-01-01T00:00Z", (1970, 1, 1, 0, 0, 0)),
+            ("1999-12-31T23:59:59Z", (1999, 12, 31, 23, 59, 59)),
+            ("2000-02-29T06:07:08Z", (2000, 2, 29, 6, 7, 8)),
+            ("1900-03-01T00:00Z", (1900, 3, 1, 0, 0, 0)),
+            ("1601-01-01T12:00Z", (1601, 1, 1, 12, 0, 0)),
+            ("-000001-06-15T01:02:03Z", (-1, 6, 15, 1, 2, 3)),
+        ];
+
+        for (s, expected) in test_strings {
+            let instant = Instant::from_str(s).unwrap();
+            let iso = IsoDateTime::from_epoch_nanos(&instant.nanos, 0.0).unwrap();
+            assert_eq!(
+                (
+                    iso.date.year,
+                    iso.date.month,
+                    iso.date.day,
+                    iso.time.hour,
+                    iso.time.minute,
+                    iso.time.second
+                ),
+                expected,
+                "{s} did not match."
+            );
+        }
+    }
+
+    #[test]
+    fn epoch_nanos_keep_nanosecond_precision() {
+        let nanos = BigInt::from(1_700_000_000_123_456_789i64);
+        let iso = IsoDateTime::from_epoch_nanos(&nanos, 0.0).unwrap();
+        assert_eq!(
+            (iso.date.year, iso.date.month, iso.date.day),
+            (2023, 11, 14)
+        );
+        assert_eq!(
+            (
+                iso.time.hour,
+                iso.time.minute,
+                iso.time.second,
+                iso.time.millisecond,
+                iso.time.microsecond,
+                iso.time.nanosecond
+            ),
+            (22, 13, 20, 123, 456, 789)
+        );
+    }
 }
@@ -0,0 +1,603 @@
+//! This module implements a compressed column codec for sorted epoch nanoseconds.
+//!
+//! An `InstantColumn` splits a non-decreasing sequence of epoch nanoseconds into blocks of
+//! up to `INSTANT_COLUMN_BLOCK_LEN` values. Every block is encoded independently, which
+//! allows a single block to be decoded without decoding the blocks before it.
+//!
+//! A block is laid out as:
+//!   - the first value as a 16 byte little endian integer,
+//!   - the number of values in the block as a single byte,
+//!   - the first delta as a zig-zag varint, if the block has two or more values,
+//!   - the remaining delta-of-deltas, if the block has three or more values, bit-packed
+//!     against a frame of reference. The reference is the minimum delta-of-delta written
+//!     as a zig-zag varint, followed by a byte with the bit width of the packed values.
+//!
+//! Timestamps with a regular spacing have a delta-of-delta of zero, which packs into zero
+//! bits, so such a block only costs its header.
+
+use std::ops::Range;
+
+use num_bigint::BigInt;
+use num_traits::ToPrimitive;
+
+use crate::{
+    components::Instant, iso::IsoDateTime, TemporalError, TemporalResult, TemporalUnwrap,
+    NS_MAX_INSTANT, NS_MIN_INSTANT, NS_PER_DAY,
+};
+
+/// The maximum number of values held in a single block of an `InstantColumn`.
+pub const INSTANT_COLUMN_BLOCK_LEN: usize = 128;
+
+// NOTE: Delta-of-deltas of valid instants are bounded by 4 * NS_MAX_INSTANT, which fits in
+// 75 bits. Any larger width can only come from corrupt data.
+const MAX_PACKED_WIDTH: u32 = 76;
+
+/// A compressed column of sorted epoch nanoseconds.
+///
+/// The column is built from a non-decreasing sequence of valid epoch nanoseconds and can be
+/// decoded back into epoch nanoseconds, `Instant`s, or `IsoDateTime`s, either completely or
+/// one block at a time.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct InstantColumn {
+    len: usize,
+    /// The byte offset of each block in `data`.
+    blocks: Vec<usize>,
+    data: Vec<u8>,
+}
+
+// ==== Public API ====
+
+impl InstantColumn {
+    /// Encodes a non-decreasing slice of epoch nanoseconds into a new `InstantColumn`.
+    pub fn from_epoch_nanoseconds(values: &[i128]) -> TemporalResult<Self> {
+        let mut previous = NS_MIN_INSTANT;
+        for &value in values {
+            if !(NS_MIN_INSTANT..=NS_MAX_INSTANT).contains(&value) {
+                return Err(TemporalError::range()
+                    .with_message("Instant nanoseconds are not within a valid epoch range."));
+            }
+            if value < previous {
+                return Err(
+                    TemporalError::range().with_message("Instant column values must be sorted.")
+                );
+            }
+            previous = value;
+        }
+
+        let mut blocks = Vec::with_capacity(values.len().div_ceil(INSTANT_COLUMN_BLOCK_LEN));
+        let mut data = Vec::new();
+        for block in values.chunks(INSTANT_COLUMN_BLOCK_LEN) {
+            blocks.push(data.len());
+            encode_block(block, &mut data);
+        }
+
+        Ok(Self {
+            len: values.len(),
+            blocks,
+            data,
+        })
+    }
+
+    /// Encodes a sorted slice of `Instant`s into a new `InstantColumn`.
+    pub fn from_instants(instants: &[Instant]) -> TemporalResult<Self> {
+        let values = instants
+            .iter()
+            .map(|instant| instant.nanos.to_i128().temporal_unwrap())
+            .collect::<TemporalResult<Vec<_>>>()?;
+        Self::from_epoch_nanoseconds(&values)
+    }
+
+    /// Creates an `InstantColumn` from bytes previously returned by `as_bytes`.
+    ///
+    /// The bytes are fully validated, so the decoding methods of the returned column only
+    /// fail for values that are out of range for the requested output type.
+    pub fn from_bytes(data: Vec<u8>) -> TemporalResult<Self> {
+        let mut blocks = Vec::new();
+        let mut values = [0; INSTANT_COLUMN_BLOCK_LEN];
+        let mut len = 0;
+        let mut offset = 0;
+        let mut previous = NS_MIN_INSTANT;
+        while offset < data.len() {
+            // Values are located by `index / INSTANT_COLUMN_BLOCK_LEN`, so only the final
+            // block may hold fewer values.
+            if len % INSTANT_COLUMN_BLOCK_LEN != 0 {
+                return Err(invalid_data());
+            }
+            blocks.push(offset);
+            let (count, end) = decode_block(&data, offset, &mut values)?;
+            if values[0] < previous {
+                return Err(invalid_data());
+            }
+            previous = values[count - 1];
+            len += count;
+            offset = end;
+        }
+
+        Ok(Self { len, blocks, data })
+    }
+
+    /// Returns the encoded bytes of this `InstantColumn`.
+    #[inline]
+    #[must_use]
+    pub fn as_bytes(&self) -> &[u8] {
+        &self.data
+    }
+
+    /// Returns the number of values in this `InstantColumn`.
+    #[inline]
+    #[must_use]
+    pub fn len(&self) -> usize {
+        self.len
+    }
+
+    /// Returns whether this `InstantColumn` has no values.
+    #[inline]
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.len == 0
+    }
+
+    /// Returns the number of blocks in this `InstantColumn`.
+    #[inline]
+    #[must_use]
+    pub fn block_count(&self) -> usize {
+        self.blocks.len()
+    }
+
+    /// Returns the range of value indices held by `block`, or `None` if the block does not
+    /// exist.
+    #[must_use]
+    pub fn block_range(&self, block: usize) -> Option<Range<usize>> {
+        if block >= self.blocks.len() {
+            return None;
+        }
+        let start = block * INSTANT_COLUMN_BLOCK_LEN;
+        Some(start..self.len.min(start + INSTANT_COLUMN_BLOCK_LEN))
+    }
+
+    /// Decodes the epoch nanoseconds of a single block, appending them to `out`.
+    pub fn decode_block(&self, block: usize, out: &mut Vec<i128>) -> TemporalResult<()> {
+        let mut values = [0; INSTANT_COLUMN_BLOCK_LEN];
+        let count = self.decode_block_into(block, &mut values)?;
+        out.extend_from_slice(&values[..count]);
+        Ok(())
+    }
+
+    /// Returns the epoch nanoseconds at `index`, decoding only the block that holds it.
+    pub fn epoch_nanoseconds(&self, index: usize) -> TemporalResult<Option<i128>> {
+        if index >= self.len {
+            return Ok(None);
+        }
+        let mut values = [0; INSTANT_COLUMN_BLOCK_LEN];
+        self.decode_block_into(index / INSTANT_COLUMN_BLOCK_LEN, &mut values)?;
+        Ok(Some(values[index % INSTANT_COLUMN_BLOCK_LEN]))
+    }
+
+    /// Returns the `Instant` at `index`, decoding only the block that holds it.
+    pub fn instant(&self, index: usize) -> TemporalResult<Option<Instant>> {
+        Ok(self.epoch_nanoseconds(index)?.map(|nanos| Instant {
+            nanos: BigInt::from(nanos),
+        }))
+    }
+
+    /// Decodes all values of this `InstantColumn` as epoch nanoseconds.
+    pub fn to_epoch_nanoseconds(&self) -> TemporalResult<Vec<i128>> {
+        let mut result = Vec::with_capacity(self.len);
+        for block in 0..self.blocks.len() {
+            self.decode_block(block, &mut result)?;
+        }
+        Ok(result)
+    }
+
+    /// Decodes all values of this `InstantColumn` as `Instant`s.
+    pub fn to_instants(&self) -> TemporalResult<Vec<Instant>> {
+        let mut result = Vec::with_capacity(self.len);
+        self.for_each(|nanos| {
+            result.push(Instant {
+                nanos: BigInt::from(nanos),
+            });
+        })?;
+        Ok(result)
+    }
+
+    /// Decodes all values of this `InstantColumn` as `IsoDateTime`s in the provided UTC
+    /// offset, which must be less than a day.
+    pub fn to_iso_date_times(&self, offset_nanoseconds: i64) -> TemporalResult<Vec<IsoDateTime>> {
+        if offset_nanoseconds.unsigned_abs() >= NS_PER_DAY {
+            return Err(TemporalError::range().with_message("UTC offset must be less than a day."));
+        }
+        let offset = i128::from(offset_nanoseconds);
+        let mut result = Vec::with_capacity(self.len);
+        // NOTE: A valid instant with an offset of less than a day is always within the
+        // `IsoDateTime` limits.
+        self.for_each(|nanos| result.push(IsoDateTime::from_nanoseconds(nanos + offset)))?;
+        Ok(result)
+    }
+}
+
+// ==== Private API ====
+
+impl InstantColumn {
+    fn decode_block_into(
+        &self,
+        block: usize,
+        values: &mut [i128; INSTANT_COLUMN_BLOCK_LEN],
+    ) -> TemporalResult<usize> {
+        let offset = *self.blocks.get(block).ok_or_else(|| {
+            TemporalError::range().with_message("Instant column block is out of range.")
+        })?;
+        decode_block(&self.data, offset, values).map(|(count, _)| count)
+    }
+
+    fn for_each(&self, mut f: impl FnMut(i128)) -> TemporalResult<()> {
+        let mut values = [0; INSTANT_COLUMN_BLOCK_LEN];
+        for block in 0..self.blocks.len() {
+            let count = self.decode_block_into(block, &mut values)?;
+            values[..count].iter().for_each(|value| f(*value));
+        }
+        Ok(())
+    }
+}
+
+// ==== Block encoding ====
+
+/// Encodes a non-empty block of at most `INSTANT_COLUMN_BLOCK_LEN` sorted values.
+fn encode_block(values: &[i128], data: &mut Vec<u8>) {
+    debug_assert!(!values.is_empty() && values.len() <= INSTANT_COLUMN_BLOCK_LEN);
+    data.extend_from_slice(&values[0].to_le_bytes());
+    data.push(values.len() as u8);
+    if values.len() < 2 {
+        return;
+    }
+
+    write_varint(data, zigzag_encode(values[1] - values[0]));
+    if values.len() < 3 {
+        return;
+    }
+
+    let delta_of_delta = |w: &[i128]| (w[2] - w[1]) - (w[1] - w[0]);
+    let reference = values.windows(3).map(delta_of_delta).min().unwrap_or(0);
+    let range = values
+        .windows(3)
+        .map(|w| (delta_of_delta(w) - reference) as u128)
+        .max()
+        .unwrap_or(0);
+    let width = u128::BITS - range.leading_zeros();
+    write_varint(data, zigzag_encode(reference));
+    data.push(width as u8);
+
+    let mut writer = BitWriter::new(data);
+    for window in values.windows(3) {
+        writer.write((delta_of_delta(window) - reference) as u128, width);
+    }
+    writer.finish();
+}
+
+/// Decodes the block at `offset` into `values`, returning the number of values decoded and
+/// the offset of the next block.
+fn decode_block(
+    data: &[u8],
+    offset: usize,
+    values: &mut [i128; INSTANT_COLUMN_BLOCK_LEN],
+) -> TemporalResult<(usize, usize)> {
+    let mut reader = ByteReader { data, pos: offset };
+    let first = i128::from_le_bytes(reader.read_array()?);
+    let count = usize::from(reader.read_u8()?);
+    if count == 0 || count > INSTANT_COLUMN_BLOCK_LEN {
+        return Err(invalid_data());
+    }
+    values[0] = check_value(first, NS_MIN_INSTANT)?;
+    if count < 2 {
+        return Ok((count, reader.pos));
+    }
+
+    let mut delta = zigzag_decode(reader.read_varint()?);
+    values[1] = check_value(first.checked_add(delta).ok_or_else(invalid_data)?, first)?;
+    if count < 3 {
+        return Ok((count, reader.pos));
+    }
+
+    let reference = zigzag_decode(reader.read_varint()?);
+    let width = u32::from(reader.read_u8()?);
+    if width > MAX_PACKED_WIDTH {
+        return Err(invalid_data());
+    }
+    let packed_len = ((count - 2) * width as usize).div_ceil(8);
+    let packed = reader.read_slice(packed_len)?;
+
+    let mut bits = BitReader::new(packed);
+    for i in 2..count {
+        let delta_of_delta = reference
+            .checked_add(bits.read(width) as i128)
+            .ok_or_else(invalid_data)?;
+        delta = delta.checked_add(delta_of_delta).ok_or_else(invalid_data)?;
+        let value = values[i - 1].checked_add(delta).ok_or_else(invalid_data)?;
+        values[i] = check_value(value, values[i - 1])?;
+    }
+
+    Ok((count, reader.pos))
+}
+
+/// Checks that a decoded value is a valid epoch nanosecond that is not less than `previous`.
+#[inline]
+fn check_value(value: i128, previous: i128) -> TemporalResult<i128> {
+    if value < previous || value > NS_MAX_INSTANT {
+        return Err(invalid_data());
+    }
+    Ok(value)
+}
+
+#[inline]
+fn invalid_data() -> TemporalError {
+    TemporalError::range().with_message("Invalid instant column data.")
+}
+
+// ==== Integer encodings ====
+
+#[inline]
+const fn zigzag_encode(value: i128) -> u128 {
+    ((value << 1) ^ (value >> 127)) as u128
+}
+
+#[inline]
+const fn zigzag_decode(value: u128) -> i128 {
+    (value >> 1) as i128 ^ -((value & 1) as i128)
+}
+
+/// Writes `value` as an unsigned LEB128 varint.
+fn write_varint(data: &mut Vec<u8>, mut value: u128) {
+    while value >= 0x80 {
+        data.push((value as u8 & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    data.push(value as u8);
+}
+
+struct ByteReader<'a> {
+    data: &'a [u8],
+    pos: usize,
+}
+
+impl<'a> ByteReader<'a> {
+    fn read_slice(&mut self, len: usize) -> TemporalResult<&'a [u8]> {
+        let end = self.pos.checked_add(len).ok_or_else(invalid_data)?;
+        let slice = self.data.get(self.pos..end).ok_or_else(invalid_data)?;
+        self.pos = end;
+        Ok(slice)
+    }
+
+    fn read_array<const N: usize>(&mut self) -> TemporalResult<[u8; N]> {
+        self.read_slice(N)?
+            .try_into()
+            .map_err(|_| TemporalError::assert())
+    }
+
+    fn read_u8(&mut self) -> TemporalResult<u8> {
+        Ok(self.read_array::<1>()?[0])
+    }
+
+    fn read_varint(&mut self) -> TemporalResult<u128> {
+        let mut result = 0u128;
+        let mut shift = 0;
+        loop {
+            let byte = self.read_u8()?;
+            let bits = u128::from(byte & 0x7F);
+            if shift >= u128::BITS || (bits << shift) >> shift != bits {
+                return Err(invalid_data());
+            }
+            result |= bits << shift;
+            if byte & 0x80 == 0 {
+                return Ok(result);
+            }
+            shift += 7;
+        }
+    }
+}
+
+// ==== Bit packing ====
+
+/// Writes values of up to `MAX_PACKED_WIDTH` bits, least significant bit first.
+struct BitWriter<'a> {
+    data: &'a mut Vec<u8>,
+    buffer: u128,
+    len: u32,
+}
+
+impl<'a> BitWriter<'a> {
+    fn new(data: &'a mut Vec<u8>) -> Self {
+        Self {
+            data,
+            buffer: 0,
+            len: 0,
+        }
+    }
+
+    fn write(&mut self, value: u128, width: u32) {
+        debug_assert!(width <= MAX_PACKED_WIDTH);
+        if width == 0 {
+            return;
+        }
+        // NOTE: Fewer than 8 bits are buffered between writes, so the buffer cannot overflow.
+        self.buffer |= value << self.len;
+        self.len += width;
+        while self.len >= 8 {
+            self.data.push(self.buffer as u8);
+            self.buffer >>= 8;
+            self.len -= 8;
+        }
+    }
+
+    fn finish(self) {
+        if self.len > 0 {
+            self.data.push(self.buffer as u8);
+        }
+    }
+}
+
+/// Reads values written by a `BitWriter` from a slice that holds all of the packed bits.
+struct BitReader<'a> {
+    data: &'a [u8],
+    buffer: u128,
+    len: u32,
+}
+
+impl<'a> BitReader<'a> {
+    fn new(data: &'a [u8]) -> Self {
+        Self {
+            data,
+            buffer: 0,
+            len: 0,
+        }
+    }
+
+    fn read(&mut self, width: u32) -> u128 {
+        if width == 0 {
+            return 0;
+        }
+        while self.len < width {
+            let Some((byte, rest)) = self.data.split_first() else {
+                break;
+            };
+            self.buffer |= u128::from(*byte) << self.len;
+            self.len += 8;
+            self.data = rest;
+        }
+        let value = self.buffer & ((1u128 << width) - 1);
+        self.buffer >>= width;
+        self.len = self.len.saturating_sub(width);
+        value
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::{InstantColumn, INSTANT_COLUMN_BLOCK_LEN};
+    use crate::{NS_MAX_INSTANT, NS_MIN_INSTANT, NS_PER_DAY};
+
+    fn round_trip(values: &[i128]) -> InstantColumn {
+        let column = InstantColumn::from_epoch_nanoseconds(values).unwrap();
+        assert_eq!(column.len(), values.len());
+        assert_eq!(column.to_epoch_nanoseconds().unwrap(), values);
+        let bytes = InstantColumn::from_bytes(column.as_bytes().to_vec()).unwrap();
+        assert_eq!(bytes, column);
+        column
+    }
+
+    #[test]
+    fn column_round_trip() {
+        for len in [0, 1, 2, 3, 127, 128, 129, 300] {
+            let regular = (0..len).map(|i| 1_700_000_000_000_000_000 + i * 1_000_000_000);
+            round_trip(&regular.collect::<Vec<_>>());
+
+            // A deterministic, irregular sequence with repeated values.
+            let mut value = -1_000_000_000_000_000_000i128;
+            let irregular = (0..len)
+                .map(|i| {
+                    value += (i * i * 7_919) % 1_000_003;
+                    value
+                })
+                .collect::<Vec<_>>();
+            round_trip(&irregular);
+        }
+
+        round_trip(&[NS_MIN_INSTANT, NS_MIN_INSTANT, 0, NS_MAX_INSTANT]);
+        round_trip(&[NS_MIN_INSTANT, NS_MAX_INSTANT, NS_MAX_INSTANT]);
+    }
+
+    #[test]
+    fn regular_columns_compress() {
+        let values = (0..10_000)
+            .map(|i| 1_700_000_000_000_000_000 + i * 1_000_000_000)
+            .collect::<Vec<_>>();
+        let column = round_trip(&values);
+        // Each block only holds its header: first value, count, first delta, and reference.
+        assert!(column.as_bytes().len() < column.block_count() * 32);
+    }
+
+    #[test]
+    fn random_access() {
+        let values = (0..1000i128).map(|i| i * i * 1_000).collect::<Vec<_>>();
+        let column = round_trip(&values);
+        assert_eq!(
+            column.block_count(),
+            1000usize.div_ceil(INSTANT_COLUMN_BLOCK_LEN)
+        );
+
+        for index in [0, 1, 127, 128, 500, 999] {
+            assert_eq!(
+                column.epoch_nanoseconds(index).unwrap(),
+                Some(values[index])
+            );
+        }
+        assert_eq!(column.epoch_nanoseconds(1000).unwrap(), None);
+
+        let range = column.block_range(7).unwrap();
+        assert_eq!(range, 896..1000);
+        let mut block = Vec::new();
+        column.decode_block(7, &mut block).unwrap();
+        assert_eq!(block, values[range]);
+        assert!(column.block_range(8).is_none());
+        assert!(column.decode_block(8, &mut block).is_err());
+    }
+
+    #[test]
+    #[allow(clippy::float_cmp)]
+    fn decode_to_instants_and_date_times() {
+        let values = [0, 86_399_999_999_999, 951_782_400_000_000_001];
+        let column = round_trip(&values);
+
+        let instants = column.to_instants().unwrap();
+        assert_eq!(instants[1].epoch_nanoseconds(), 86_399_999_999_999.0);
+        assert_eq!(column.instant(2).unwrap(), Some(instants[2].clone()));
+
+        let date_times = column.to_iso_date_times(0).unwrap();
+        for (date_time, value) in date_times.iter().zip(values) {
+            assert_eq!(date_time.as_nanoseconds(), value);
+        }
+        // 2000-02-29T00:00:00.000000001Z
+        let leap_day = date_times[2];
+        assert_eq!(
+            (leap_day.date.year, leap_day.date.month, leap_day.date.day),
+            (2000, 2, 29)
+        );
+        assert_eq!(leap_day.time.nanosecond, 1);
+
+        let offset = column.to_iso_date_times(-3_600_000_000_000).unwrap();
+        assert_eq!((offset[0].date.day, offset[0].time.hour), (31, 23));
+        assert!(column.to_iso_date_times(NS_PER_DAY as i64).is_err());
+    }
+
+    #[test]
+    fn invalid_columns() {
+        assert!(InstantColumn::from_epoch_nanoseconds(&[2, 1]).is_err());
+        assert!(InstantColumn::from_epoch_nanoseconds(&[NS_MAX_INSTANT + 1]).is_err());
+
+        let values = (0..200).map(|i| i * 3_600_000_000_000).collect::<Vec<_>>();
+        let bytes = InstantColumn::from_epoch_nanoseconds(&values)
+            .unwrap()
+            .as_bytes()
+            .to_vec();
+        for len in [1, 16, 17, bytes.len() - 1] {
+            assert!(InstantColumn::from_bytes(bytes[..len].to_vec()).is_err());
+        }
+
+        // A short block that is not the final block.
+        let short = InstantColumn::from_epoch_nanoseconds(&values[..10]).unwrap();
+        let full =
+            InstantColumn::from_epoch_nanoseconds(&values[10..10 + INSTANT_COLUMN_BLOCK_LEN])
+                .unwrap();
+        let mut invalid = short.as_bytes().to_vec();
+        invalid.extend_from_slice(full.as_bytes());
+        assert!(InstantColumn::from_bytes(invalid).is_err());
+        let tail = InstantColumn::from_epoch_nanoseconds(&values[138..148]).unwrap();
+        let mut valid = full.as_bytes().to_vec();
+        valid.extend_from_slice(tail.as_bytes());
+        let column = InstantColumn::from_bytes(valid).unwrap();
+        assert_eq!(column.epoch_nanoseconds(130).unwrap(), Some(values[140]));
+
+        // A first value outside of the valid epoch range.
+        let mut invalid = (NS_MAX_INSTANT + 1).to_le_bytes().to_vec();
+        invalid.push(1);
+        assert!(InstantColumn::from_bytes(invalid).is_err());
+    }
+}
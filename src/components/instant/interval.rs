@@ -0,0 +1,406 @@
+//! This module implements half-open `Instant` intervals and a static index for interval queries.
+//!
+//! The `IntervalIndex` is a priority search tree stored in a flat array in heap order. Every
+//! node holds the interval with the latest end in its subtree, and the remaining intervals are
+//! split at their median start between the two children. A query only descends into subtrees
+//! that can still hold a match, which answers stabbing, overlap, and containment queries in
+//! O(log n + k) for k reported intervals.
+
+use num_bigint::BigInt;
+use num_traits::ToPrimitive;
+
+use crate::{
+    components::Instant, TemporalError, TemporalResult, TemporalUnwrap, NS_MAX_INSTANT,
+    NS_MIN_INSTANT,
+};
+
+/// A half-open interval of time, `[start, end)`, between two instants.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, PartialOrd, Ord, Hash)]
+pub struct InstantInterval {
+    start: i128,
+    end: i128,
+}
+
+// ==== Public API ====
+
+impl InstantInterval {
+    /// Creates a new `InstantInterval` from `start` up to, but not including, `end`.
+    pub fn new(start: &Instant, end: &Instant) -> TemporalResult<Self> {
+        Self::from_epoch_nanoseconds(
+            start.nanos.to_i128().temporal_unwrap()?,
+            end.nanos.to_i128().temporal_unwrap()?,
+        )
+    }
+
+    /// Creates a new `InstantInterval` from a start and end in epoch nanoseconds.
+    pub fn from_epoch_nanoseconds(start: i128, end: i128) -> TemporalResult<Self> {
+        let range = NS_MIN_INSTANT..=NS_MAX_INSTANT;
+        if !range.contains(&start) || !range.contains(&end) {
+            return Err(TemporalError::range()
+                .with_message("Instant nanoseconds are not within a valid epoch range."));
+        }
+        if start > end {
+            return Err(TemporalError::range()
+                .with_message("InstantInterval start must not be after its end."));
+        }
+        Ok(Self { start, end })
+    }
+
+    /// Returns the start of this `InstantInterval` in epoch nanoseconds.
+    #[inline]
+    #[must_use]
+    pub const fn start_epoch_nanoseconds(&self) -> i128 {
+        self.start
+    }
+
+    /// Returns the exclusive end of this `InstantInterval` in epoch nanoseconds.
+    #[inline]
+    #[must_use]
+    pub const fn end_epoch_nanoseconds(&self) -> i128 {
+        self.end
+    }
+
+    /// Returns the start of this `InstantInterval`.
+    #[must_use]
+    pub fn start(&self) -> Instant {
+        Instant {
+            nanos: BigInt::from(self.start),
+        }
+    }
+
+    /// Returns the exclusive end of this `InstantInterval`.
+    #[must_use]
+    pub fn end(&self) -> Instant {
+        Instant {
+            nanos: BigInt::from(self.end),
+        }
+    }
+
+    /// Returns whether this `InstantInterval` contains no instants.
+    #[inline]
+    #[must_use]
+    pub const fn is_empty(&self) -> bool {
+        self.start == self.end
+    }
+
+    /// Returns whether this `InstantInterval` contains the provided epoch nanoseconds.
+    #[inline]
+    #[must_use]
+    pub const fn contains_epoch_nanoseconds(&self, epoch_nanoseconds: i128) -> bool {
+        self.start <= epoch_nanoseconds && epoch_nanoseconds < self.end
+    }
+
+    /// Returns whether this `InstantInterval` contains the provided `Instant`.
+    #[must_use]
+    pub fn contains(&self, instant: &Instant) -> bool {
+        instant
+            .nanos
+            .to_i128()
+            .is_some_and(|nanos| self.contains_epoch_nanoseconds(nanos))
+    }
+
+    /// Returns whether every instant of `other` is within this `InstantInterval`.
+    #[inline]
+    #[must_use]
+    pub const fn contains_interval(&self, other: &Self) -> bool {
+        self.start <= other.start && other.end <= self.end
+    }
+
+    /// Returns whether this `InstantInterval` and `other` share at least one instant.
+    #[inline]
+    #[must_use]
+    pub const fn overlaps(&self, other: &Self) -> bool {
+        !self.is_empty() && !other.is_empty() && self.start < other.end && other.start < self.end
+    }
+
+    /// Returns the instants shared by this `InstantInterval` and `other`, or `None` if they do
+    /// not overlap.
+    #[must_use]
+    pub fn intersection(&self, other: &Self) -> Option<Self> {
+        self.overlaps(other).then(|| Self {
+            start: self.start.max(other.start),
+            end: self.end.min(other.end),
+        })
+    }
+
+    /// Returns the instants between this `InstantInterval` and `other`, or `None` if they
+    /// overlap or are adjacent.
+    #[must_use]
+    pub fn gap(&self, other: &Self) -> Option<Self> {
+        let (first, second) = if self.start <= other.start {
+            (self, other)
+        } else {
+            (other, self)
+        };
+        (first.end < second.start).then_some(Self {
+            start: first.end,
+            end: second.start,
+        })
+    }
+}
+
+/// A static index over a set of `InstantInterval`s.
+///
+/// The index is built once in bulk and answers queries with the positions of the matching
+/// intervals in the slice it was built from. Empty intervals never overlap or contain an
+/// instant, so they are not indexed.
+#[derive(Debug, Clone, Default)]
+pub struct IntervalIndex {
+    nodes: Vec<Option<Node>>,
+    len: usize,
+}
+
+#[derive(Debug, Clone, Copy)]
+struct Node {
+    start: i128,
+    end: i128,
+    /// The position of the interval in the source slice.
+    position: usize,
+    /// The earliest start in this node's subtree.
+    min_start: i128,
+}
+
+impl IntervalIndex {
+    /// Builds a new `IntervalIndex` from a slice of intervals.
+    #[must_use]
+    pub fn new(intervals: &[InstantInterval]) -> Self {
+        let mut items = intervals
+            .iter()
+            .enumerate()
+            .filter(|(_, interval)| !interval.is_empty())
+            .map(|(position, interval)| (interval.start, interval.end, position))
+            .collect::<Vec<_>>();
+        items.sort_unstable();
+
+        let mut index = Self {
+            nodes: Vec::new(),
+            len: items.len(),
+        };
+        index.build(0, &mut items);
+        index
+    }
+
+    /// Returns the number of indexed intervals.
+    #[inline]
+    #[must_use]
+    pub fn len(&self) -> usize {
+        self.len
+    }
+
+    /// Returns whether the index holds no intervals.
+    #[inline]
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.len == 0
+    }
+
+    /// Returns the positions of the intervals that contain the provided epoch nanoseconds.
+    #[must_use]
+    pub fn stab(&self, epoch_nanoseconds: i128) -> Vec<usize> {
+        self.query(epoch_nanoseconds, epoch_nanoseconds)
+    }
+
+    /// Returns the positions of the intervals that overlap the provided interval.
+    #[must_use]
+    pub fn overlapping(&self, interval: &InstantInterval) -> Vec<usize> {
+        if interval.is_empty() {
+            return Vec::new();
+        }
+        self.query(interval.end - 1, interval.start)
+    }
+
+    /// Returns the positions of the intervals that contain the provided interval.
+    #[must_use]
+    pub fn containing(&self, interval: &InstantInterval) -> Vec<usize> {
+        self.query(interval.start, interval.end - 1)
+    }
+
+    /// Returns the parts of `window` that are not covered by any indexed interval, in order.
+    #[must_use]
+    pub fn gaps(&self, window: &InstantInterval) -> Vec<InstantInterval> {
+        let mut covered = Vec::new();
+        if !window.is_empty() {
+            self.visit(0, window.end - 1, window.start, &mut |node| {
+                covered.push((node.start, node.end));
+            });
+        }
+        covered.sort_unstable();
+
+        let mut gaps = Vec::new();
+        let mut cursor = window.start;
+        for (start, end) in covered {
+            if start > cursor {
+                gaps.push(InstantInterval {
+                    start: cursor,
+                    end: start,
+                });
+            }
+            cursor = cursor.max(end);
+        }
+        if cursor < window.end {
+            gaps.push(InstantInterval {
+                start: cursor,
+                end: window.end,
+            });
+        }
+        gaps
+    }
+}
+
+// ==== Private API ====
+
+impl IntervalIndex {
+    /// Builds the subtree at `pos` from `items`, which are sorted by start.
+    fn build(&mut self, pos: usize, items: &mut [(i128, i128, usize)]) {
+        let Some(&(min_start, _, _)) = items.first() else {
+            return;
+        };
+        if self.nodes.len() <= pos {
+            self.nodes.resize(pos + 1, None);
+        }
+
+        // Move the interval with the latest end to the front while keeping the rest sorted.
+        let mut top = 0;
+        for (i, item) in items.iter().enumerate() {
+            if item.1 > items[top].1 {
+                top = i;
+            }
+        }
+        items[..=top].rotate_right(1);
+
+        let [(start, end, position), rest @ ..] = items else {
+            return;
+        };
+        self.nodes[pos] = Some(Node {
+            start: *start,
+            end: *end,
+            position: *position,
+            min_start,
+        });
+
+        let (left, right) = rest.split_at_mut(rest.len() / 2);
+        self.build(2 * pos + 1, left);
+        self.build(2 * pos + 2, right);
+    }
+
+    /// Returns the sorted positions of the intervals with a start no later than `max_start`
+    /// and an end after `end_after`.
+    fn query(&self, max_start: i128, end_after: i128) -> Vec<usize> {
+        let mut result = Vec::new();
+        self.visit(0, max_start, end_after, &mut |node| {
+            result.push(node.position)
+        });
+        result.sort_unstable();
+        result
+    }
+
+    fn visit(&self, pos: usize, max_start: i128, end_after: i128, f: &mut impl FnMut(&Node)) {
+        let Some(Some(node)) = self.nodes.get(pos) else {
+            return;
+        };
+        // NOTE: Every interval in the subtree starts no earlier than `min_start` and ends no
+        // later than `node.end`, so the whole subtree can be skipped.
+        if node.min_start > max_start || node.end <= end_after {
+            return;
+        }
+        if node.start <= max_start {
+            f(node);
+        }
+        self.visit(2 * pos + 1, max_start, end_after, f);
+        self.visit(2 * pos + 2, max_start, end_after, f);
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::{InstantInterval, IntervalIndex};
+
+    fn interval(start: i128, end: i128) -> InstantInterval {
+        InstantInterval::from_epoch_nanoseconds(start, end).unwrap()
+    }
+
+    #[test]
+    #[allow(clippy::float_cmp)]
+    fn interval_relations() {
+        let a = interval(0, 10);
+        let b = interval(5, 15);
+        let c = interval(10, 20);
+
+        assert!(a.contains_epoch_nanoseconds(0));
+        assert!(!a.contains_epoch_nanoseconds(10));
+        assert!(a.overlaps(&b) && !a.overlaps(&c));
+        assert_eq!(a.intersection(&b), Some(interval(5, 10)));
+        assert_eq!(a.intersection(&c), None);
+        assert_eq!(a.gap(&c), None);
+        assert_eq!(interval(30, 40).gap(&a), Some(interval(10, 30)));
+        assert!(a.contains_interval(&interval(2, 10)));
+        assert!(!a.contains_interval(&b));
+
+        // Empty intervals overlap nothing.
+        assert!(!a.overlaps(&interval(5, 5)));
+        assert!(InstantInterval::from_epoch_nanoseconds(1, 0).is_err());
+        assert!(InstantInterval::from_epoch_nanoseconds(0, crate::NS_MAX_INSTANT + 1).is_err());
+        assert_eq!(a.start().epoch_nanoseconds(), 0.0);
+    }
+
+    #[test]
+    fn index_matches_linear_scan() {
+        // A deterministic pseudo-random set of intervals.
+        let mut seed = 0x2545_f491_4f6c_dd1du64;
+        let mut next = move |bound: u64| {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            i128::from(seed % bound)
+        };
+        let intervals = (0..2_000)
+            .map(|_| {
+                let start = next(100_000);
+                interval(start, start + next(2_000))
+            })
+            .collect::<Vec<_>>();
+        let index = IntervalIndex::new(&intervals);
+        assert_eq!(
+            index.len(),
+            intervals.iter().filter(|i| !i.is_empty()).count()
+        );
+
+        let scan = |f: &dyn Fn(&InstantInterval) -> bool| {
+            (0..intervals.len())
+                .filter(|i| f(&intervals[*i]))
+                .collect::<Vec<_>>()
+        };
+        for _ in 0..200 {
+            let point = next(110_000);
+            assert_eq!(
+                index.stab(point),
+                scan(&|i| i.contains_epoch_nanoseconds(point))
+            );
+
+            let start = next(110_000);
+            let query = interval(start, start + next(5_000));
+            assert_eq!(index.overlapping(&query), scan(&|i| i.overlaps(&query)));
+            assert_eq!(
+                index.containing(&query),
+                scan(&|i| !i.is_empty() && i.contains_interval(&query))
+            );
+        }
+    }
+
+    #[test]
+    fn index_gaps() {
+        let index = IntervalIndex::new(&[
+            interval(10, 20),
+            interval(15, 30),
+            interval(40, 50),
+            interval(45, 45),
+        ]);
+        assert_eq!(
+            index.gaps(&interval(0, 60)),
+            vec![interval(0, 10), interval(30, 40), interval(50, 60)]
+        );
+        assert_eq!(index.gaps(&interval(12, 28)), Vec::new());
+        assert_eq!(index.gaps(&interval(25, 45)), vec![interval(30, 40)]);
+        assert!(IntervalIndex::new(&[]).stab(0).is_empty());
+    }
+}
@@ -35,7 +35,9 @@ pub use datetime::DateTime;
 #[doc(inline)]
 pub use duration::Duration;
 #[doc(inline)]
-pub use instant::Instant;
+pub use instant::{
+    Instant, InstantColumn, InstantInterval, IntervalIndex, INSTANT_COLUMN_BLOCK_LEN,
+};
 #[doc(inline)]
 pub use month_day::MonthDay;
 #[doc(inline)]
@@ -1,10 +1,13 @@
 //! This module implements `Time` and any directly related algorithms.
 
+use std::str::FromStr;
+
 use crate::{
     components::{duration::TimeDuration, Duration},
     iso::IsoTime,
     options::{ArithmeticOverflow, RoundingIncrement, TemporalRoundingMode, TemporalUnit},
-    TemporalError, TemporalResult,
+    parsers::parse_time,
+    TemporalError, TemporalResult, TemporalUnwrap, TimeFields,
 };
 
 /// The native Rust implementation of `Temporal.PlainTime`.
@@ -20,7 +23,7 @@ impl Time {
     #[inline]
     #[must_use]
     /// Creates a new unvalidated `Time`.
-    pub(crate) fn new_unchecked(iso: IsoTime) -> Self {
+    pub(crate) const fn new_unchecked(iso: IsoTime) -> Self {
         Self { iso }
     }
 
@@ -117,6 +120,23 @@ impl Time {
 // ==== Public API ====
 
 impl Time {
+    /// Creates a new `Time` in a const context, returning `None` if the time is not valid.
+    #[inline]
+    #[must_use]
+    pub const fn try_new(
+        hour: u8,
+        minute: u8,
+        second: u8,
+        millisecond: u16,
+        microsecond: u16,
+        nanosecond: u16,
+    ) -> Option<Self> {
+        match IsoTime::try_new(hour, minute, second, millisecond, microsecond, nanosecond) {
+            Some(iso) => Some(Self::new_unchecked(iso)),
+            None => None,
+        }
+    }
+
     /// Creates a new `IsoTime` value.
     pub fn new(
         hour: i32,
@@ -139,6 +159,24 @@ impl Time {
         Ok(Self::new_unchecked(time))
     }
 
+    /// Creates a new `Time` with the provided fields replaced, where `overflow` defaults to
+    /// "constrain".
+    ///
+    /// Equivalent: `Temporal.PlainTime.prototype.with`
+    pub fn with(
+        &self,
+        fields: &TimeFields,
+        overflow: Option<ArithmeticOverflow>,
+    ) -> TemporalResult<Self> {
+        if fields.is_empty() {
+            return Err(TemporalError::r#type().with_message("No fields were provided to with."));
+        }
+        let iso = self
+            .iso
+            .with(fields, overflow.unwrap_or(ArithmeticOverflow::Constrain))?;
+        Ok(Self::new_unchecked(iso))
+    }
+
     /// Returns the internal `hour` field.
     #[inline]
     #[must_use]
@@ -283,14 +321,34 @@ impl Time {
     }
 }
 
+// ==== Trait impls ====
+
+impl FromStr for Time {
+    type Err = TemporalError;
+
+    fn from_str(s: &str) -> Result<Self, Self::Err> {
+        let record = parse_time(s)?;
+
+        let time = record.time.temporal_unwrap()?;
+
+        let iso = IsoTime::from_time_record(time.hour, time.minute, time.second, time.nanosecond)?;
+
+        Ok(Self::new_unchecked(iso))
+    }
+}
+
 // ==== Test land ====
 
 #[cfg(test)]
 mod tests {
+    use std::str::FromStr;
+
     use crate::{
         components::Duration,
+        error::ErrorKind,
         iso::IsoTime,
         options::{ArithmeticOverflow, TemporalUnit},
+        TimeFields,
     };
 
     use super::Time;
@@ -517,4 +575,58 @@ mod tests {
             Time::new(3, 34, 56, 987, 654, 500, ArithmeticOverflow::Constrain).unwrap()
         );
     }
+
+    #[test]
+    fn time_from_str() {
+        let result = Time::from_str("T15:23:30.123456789").unwrap();
+        assert_time(result, (15, 23, 30, 123, 456, 789));
+
+        let result = Time::from_str("15:23").unwrap();
+        assert_time(result, (15, 23, 0, 0, 0, 0));
+
+        let result = Time::from_str("2020-01-01T15:23:30.5").unwrap();
+        assert_time(result, (15, 23, 30, 500, 0, 0));
+
+        // Leap seconds are constrained.
+        let result = Time::from_str("23:59:60").unwrap();
+        assert_time(result, (23, 59, 59, 0, 0, 0));
+
+        for s in ["2020-01-01", "24:00", "T", ""] {
+            assert!(Time::from_str(s).is_err(), "{s} should not parse.");
+        }
+
+        // A UTC designator is a RangeError.
+        for s in [
+            "15:23Z",
+            "T15:23:30z",
+            "2020-01-01T15:23Z",
+            "2020-01-01T15:23Z[UTC]",
+        ] {
+            let err = Time::from_str(s).unwrap_err();
+            assert_eq!(err.kind(), ErrorKind::Range, "{s} should not parse.");
+        }
+    }
+
+    #[test]
+    fn time_with() {
+        let base = Time::new(12, 30, 45, 100, 200, 300, ArithmeticOverflow::Reject).unwrap();
+
+        let result = base
+            .with(&TimeFields::new().with_minute(0).with_nanosecond(999), None)
+            .unwrap();
+        assert_time(result, (12, 0, 45, 100, 200, 999));
+
+        let result = base
+            .with(&TimeFields::new().with_hour(24).with_second(-1), None)
+            .unwrap();
+        assert_time(result, (23, 30, 0, 100, 200, 300));
+
+        assert!(base
+            .with(
+                &TimeFields::new().with_hour(24),
+                Some(ArithmeticOverflow::Reject)
+            )
+            .is_err());
+        assert!(base.with(&TimeFields::new(), None).is_err());
+    }
 }
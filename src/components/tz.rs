@@ -1,15 +1,26 @@
 //! This module implements the Temporal `TimeZone` and components.
 
+use std::{str::FromStr, sync::Arc};
+
+use ixdtf::parsers::records::TimeZoneRecord;
 use num_bigint::BigInt;
 use num_traits::ToPrimitive;
 
 use crate::{
     components::{calendar::CalendarSlot, DateTime, Instant},
-    TemporalError, TemporalResult,
+    TemporalError, TemporalResult, TemporalUnwrap, NS_PER_DAY,
 };
 
 use super::calendar::CalendarProtocol;
 
+mod database;
+mod registry;
+
+#[doc(inline)]
+pub use database::TzDatabase;
+#[doc(inline)]
+pub use registry::TimeZoneId;
+
 /// Any object that implements the `TzProtocol` must implement the below methods/properties.
 pub const TIME_ZONE_PROPERTIES: [&str; 3] =
     ["getOffsetNanosecondsFor", "getPossibleInstantsFor", "id"];
@@ -18,8 +29,12 @@ pub const TIME_ZONE_PROPERTIES: [&str; 3] =
 pub trait TzProtocol: Clone {
     /// The context passed to every method of the `TzProtocol`.
     type Context;
-    /// Get the Offset nanoseconds for this `TimeZone`
-    fn get_offset_nanos_for(&self, context: &mut Self::Context) -> TemporalResult<BigInt>;
+    /// Get the Offset nanoseconds for this `TimeZone` at the provided `Instant`
+    fn get_offset_nanos_for(
+        &self,
+        instant: &Instant,
+        context: &mut Self::Context,
+    ) -> TemporalResult<BigInt>;
     /// Get the possible Instant for this `TimeZone`
     fn get_possible_instant_for(&self, context: &mut Self::Context)
         -> TemporalResult<Vec<Instant>>; // TODO: Implement Instant
@@ -31,8 +46,158 @@ pub trait TzProtocol: Clone {
 #[derive(Debug, Clone)]
 #[allow(unused)]
 pub struct TimeZone {
-    pub(crate) iana: Option<String>, // TODO: ICU4X IANA TimeZone support.
+    pub(crate) iana: Option<TimeZoneId>, // TODO: ICU4X IANA TimeZone support.
     pub(crate) offset: Option<i16>,
+    /// The `TzDatabase` snapshot that was current when a named `TimeZone` was resolved.
+    pub(crate) rules: Option<Arc<TzDatabase>>,
+}
+
+impl TimeZone {
+    /// Creates a `TimeZone` from a parsed time zone annotation.
+    pub(crate) fn from_annotation(record: &TimeZoneRecord<'_>) -> TemporalResult<Self> {
+        match record {
+            TimeZoneRecord::Name(name) => Self::from_identifier(name),
+            TimeZoneRecord::Offset(offset) => {
+                if offset.second != 0 || offset.nanosecond != 0 {
+                    return Err(TemporalError::range()
+                        .with_message("TimeZone offsets must be of minute precision."));
+                }
+                let minutes = i16::from(offset.hour) * 60 + i16::from(offset.minute);
+                Ok(Self {
+                    iana: None,
+                    offset: Some(i16::from(offset.sign as i8) * minutes),
+                    rules: None,
+                })
+            }
+            #[allow(unreachable_patterns)]
+            _ => Err(TemporalError::range().with_message("Unsupported TimeZone annotation.")),
+        }
+    }
+
+    /// Resolves a named IANA `TimeZone` from its case-insensitive identifier.
+    fn from_identifier(identifier: &str) -> TemporalResult<Self> {
+        let id = TimeZoneId::resolve(identifier).ok_or_else(|| {
+            TemporalError::range().with_message("TimeZone identifier is not a known IANA TimeZone.")
+        })?;
+        Ok(Self {
+            iana: Some(id),
+            offset: None,
+            rules: Some(TzDatabase::current()),
+        })
+    }
+
+    /// Returns the offset nanoseconds of this `TimeZone` if it has a fixed offset.
+    pub(crate) fn fixed_offset_nanoseconds(&self) -> Option<i128> {
+        let minutes = match (self.offset, self.iana) {
+            (Some(offset), _) => offset,
+            (None, Some(id)) => id.fixed_offset_minutes()?,
+            (None, None) => return None,
+        };
+        Some(i128::from(minutes) * 60_000_000_000)
+    }
+
+    /// Returns the offset nanoseconds of this `TimeZone` at the provided epoch nanoseconds.
+    ///
+    /// Named `TimeZone`s use the `TzDatabase` snapshot they were resolved with, so a
+    /// `TimeZone` keeps consistent offsets when a new `TzDatabase` is installed.
+    pub(crate) fn offset_nanoseconds_for(&self, epoch_nanoseconds: i128) -> Option<i128> {
+        if let Some(offset) = self.fixed_offset_nanoseconds() {
+            return Some(offset);
+        }
+        let epoch_seconds = i64::try_from(epoch_nanoseconds.div_euclid(1_000_000_000)).ok()?;
+        let offset = self
+            .rules
+            .as_ref()?
+            .offset_seconds_for(self.iana?, epoch_seconds)?;
+        Some(i128::from(offset) * 1_000_000_000)
+    }
+
+    /// Returns the offset nanoseconds of this `TimeZone` for the provided local nanoseconds,
+    /// resolving ambiguous and skipped local times with the `compatible` disambiguation.
+    pub(crate) fn offset_nanoseconds_for_local(&self, local_nanoseconds: i128) -> Option<i128> {
+        if let Some(offset) = self.fixed_offset_nanoseconds() {
+            return Some(offset);
+        }
+        compatible_offset_for_local(local_nanoseconds, |epoch_nanoseconds| {
+            self.offset_nanoseconds_for(epoch_nanoseconds).ok_or(())
+        })
+        .ok()
+    }
+
+    /// Returns the epoch nanoseconds of the start of the local day that begins at the
+    /// provided local midnight.
+    pub(crate) fn start_of_day_nanoseconds(&self, local_midnight: i128) -> Option<i128> {
+        if let Some(offset) = self.fixed_offset_nanoseconds() {
+            return Some(local_midnight - offset);
+        }
+        start_of_day_for_local(local_midnight, |epoch_nanoseconds| {
+            self.offset_nanoseconds_for(epoch_nanoseconds).ok_or(())
+        })
+        .ok()
+    }
+
+    /// Returns whether `offset_nanoseconds` is a valid offset of this `TimeZone` for the
+    /// provided local nanoseconds.
+    pub(crate) fn offset_matches_local(
+        &self,
+        local_nanoseconds: i128,
+        offset_nanoseconds: i128,
+    ) -> Option<bool> {
+        let offset = self.offset_nanoseconds_for(local_nanoseconds - offset_nanoseconds)?;
+        Some(offset == offset_nanoseconds)
+    }
+
+    /// Returns the version of the `TzDatabase` snapshot used by this `TimeZone`, if any.
+    #[must_use]
+    pub fn database_version(&self) -> Option<&str> {
+        self.rules.as_deref().map(TzDatabase::version)
+    }
+}
+
+impl FromStr for TimeZone {
+    type Err = TemporalError;
+
+    fn from_str(s: &str) -> Result<Self, Self::Err> {
+        if let Some(offset) = parse_offset_identifier(s) {
+            return Ok(Self {
+                iana: None,
+                offset: Some(offset),
+                rules: None,
+            });
+        }
+        Self::from_identifier(s)
+    }
+}
+
+/// Parses a minute precision UTC offset identifier, i.e. `±HH`, `±HHMM`, or `±HH:MM`,
+/// returning the offset in minutes.
+fn parse_offset_identifier(s: &str) -> Option<i16> {
+    let (sign, rest) = if let Some(rest) = s.strip_prefix('+') {
+        (1, rest)
+    } else if let Some(rest) = s.strip_prefix('-').or_else(|| s.strip_prefix('\u{2212}')) {
+        (-1, rest)
+    } else {
+        return None;
+    };
+
+    let (hour, minute) = match rest.as_bytes() {
+        [h1, h2] => ([*h1, *h2], [b'0', b'0']),
+        [h1, h2, m1, m2] | [h1, h2, b':', m1, m2] => ([*h1, *h2], [*m1, *m2]),
+        _ => return None,
+    };
+
+    let to_number = |digits: [u8; 2]| {
+        digits
+            .iter()
+            .all(u8::is_ascii_digit)
+            .then(|| i16::from(digits[0] - b'0') * 10 + i16::from(digits[1] - b'0'))
+    };
+    let (hour, minute) = (to_number(hour)?, to_number(minute)?);
+    if hour > 23 || minute > 59 {
+        return None;
+    }
+
+    Some(sign * (hour * 60 + minute))
 }
 
 /// The `TimeZoneSlot` represents a `[[TimeZone]]` internal slot value.
@@ -60,28 +225,59 @@ impl<Z: TzProtocol> TimeZoneSlot<Z> {
         calendar: &CalendarSlot<C>,
         context: &mut Z::Context,
     ) -> TemporalResult<DateTime<C>> {
-        let nanos = self.get_offset_nanos_for(context)?;
-        DateTime::from_instant(instant, nanos.to_f64().unwrap_or(0.0), calendar.clone())
+        let nanos = self
+            .get_offset_nanos_for(instant, context)?
+            .to_f64()
+            .unwrap_or(0.0);
+        DateTime::from_instant(instant, nanos, calendar.clone())
+    }
+
+    /// Returns the epoch nanoseconds of the provided local nanoseconds in this `TimeZoneSlot`,
+    /// resolving ambiguous and skipped local times with the `compatible` disambiguation.
+    pub(crate) fn get_epoch_nanoseconds_for(
+        &self,
+        local_nanoseconds: i128,
+        context: &mut Z::Context,
+    ) -> TemporalResult<i128> {
+        let offset = match self {
+            Self::Tz(tz) => tz
+                .offset_nanoseconds_for_local(local_nanoseconds)
+                .ok_or_else(no_offset_rules)?,
+            Self::Protocol(p) => {
+                compatible_offset_for_local(local_nanoseconds, |epoch_nanoseconds| {
+                    let instant = Instant::new(BigInt::from(epoch_nanoseconds))?;
+                    p.get_offset_nanos_for(&instant, context)?
+                        .to_i128()
+                        .temporal_unwrap()
+                })?
+            }
+        };
+        Ok(local_nanoseconds - offset)
     }
 }
 
 impl<Z: TzProtocol> TimeZoneSlot<Z> {
-    /// Get the offset for this current `TimeZoneSlot`.
-    pub fn get_offset_nanos_for(&self, context: &mut Z::Context) -> TemporalResult<BigInt> {
+    /// Get the offset of this current `TimeZoneSlot` at the provided `Instant`.
+    pub fn get_offset_nanos_for(
+        &self,
+        instant: &Instant,
+        context: &mut Z::Context,
+    ) -> TemporalResult<BigInt> {
         // 1. Let timeZone be the this value.
         // 2. Perform ? RequireInternalSlot(timeZone, [[InitializedTemporalTimeZone]]).
         // 3. Set instant to ? ToTemporalInstant(instant).
         match self {
             Self::Tz(tz) => {
                 // 4. If timeZone.[[OffsetMinutes]] is not empty, return 𝔽(timeZone.[[OffsetMinutes]] × (60 × 10^9)).
-                if let Some(offset) = &tz.offset {
-                    return Ok(BigInt::from(i64::from(*offset) * 60_000_000_000i64));
-                }
+                // NOTE: IANA TimeZones with a fixed offset, i.e. `UTC`, are handled here as well.
                 // 5. Return 𝔽(GetNamedTimeZoneOffsetNanoseconds(timeZone.[[Identifier]], instant.[[Nanoseconds]])).
-                Err(TemporalError::range().with_message("IANA TimeZone names not yet implemented."))
+                let offset = tz
+                    .offset_nanoseconds_for(instant.nanos.to_i128().temporal_unwrap()?)
+                    .ok_or_else(no_offset_rules)?;
+                Ok(BigInt::from(offset))
             }
             // Call any custom implemented TimeZone.
-            Self::Protocol(p) => p.get_offset_nanos_for(context),
+            Self::Protocol(p) => p.get_offset_nanos_for(instant, context),
         }
     }
 
@@ -96,15 +292,87 @@ impl<Z: TzProtocol> TimeZoneSlot<Z> {
     /// Returns the current `TimeZoneSlot`'s identifier.
     pub fn id(&self, context: &mut Z::Context) -> TemporalResult<String> {
         match self {
-            Self::Tz(_) => Err(TemporalError::range().with_message("Not yet implemented.")), // TODO: Implement Display for Time Zone.
+            Self::Tz(TimeZone { iana: Some(id), .. }) => Ok(id.as_str().to_owned()),
+            Self::Tz(TimeZone {
+                offset: Some(offset),
+                ..
+            }) => {
+                let sign = if *offset < 0 { '-' } else { '+' };
+                let offset = offset.unsigned_abs();
+                Ok(format!("{sign}{:02}:{:02}", offset / 60, offset % 60))
+            }
+            Self::Tz(_) => Err(TemporalError::range().with_message("Invalid TimeZone.")),
             Self::Protocol(tz) => tz.id(context),
         }
     }
 }
 
+/// Returns the offset for the provided local nanoseconds with the `compatible`
+/// disambiguation, where `offset_for` returns the offset at an epoch nanosecond.
+///
+/// An ambiguous local time uses the offset before the transition, i.e. the earlier
+/// instant, and a skipped local time uses the offset before the transition as well, which
+/// moves it forward by the length of the gap.
+fn compatible_offset_for_local<E>(
+    local_nanoseconds: i128,
+    mut offset_for: impl FnMut(i128) -> Result<i128, E>,
+) -> Result<i128, E> {
+    // NOTE: Offsets are less than a day, so the offsets a day before and after the local
+    // time are the only candidates.
+    let day = i128::from(NS_PER_DAY);
+    let before = offset_for(local_nanoseconds - day)?;
+    let after = offset_for(local_nanoseconds + day)?;
+    if offset_for(local_nanoseconds - before)? != before
+        && offset_for(local_nanoseconds - after)? == after
+    {
+        return Ok(after);
+    }
+    Ok(before)
+}
+
+/// Returns the epoch nanoseconds of the start of the local day that begins at
+/// `local_midnight`, where `offset_for` returns the offset at an epoch nanosecond.
+///
+/// The start of the day is the earliest instant of midnight, or the offset transition when a
+/// transition skips midnight.
+///
+/// Equivalent: `GetStartOfDay ( timeZone, isoDate )`
+fn start_of_day_for_local<E>(
+    local_midnight: i128,
+    mut offset_for: impl FnMut(i128) -> Result<i128, E>,
+) -> Result<i128, E> {
+    let day = i128::from(NS_PER_DAY);
+    let before = offset_for(local_midnight - day)?;
+    let after = offset_for(local_midnight + day)?;
+    // NOTE: The larger offset is the earlier instant of an ambiguous midnight.
+    for offset in [before.max(after), before.min(after)] {
+        if offset_for(local_midnight - offset)? == offset {
+            return Ok(local_midnight - offset);
+        }
+    }
+
+    // NOTE: Midnight is skipped, so the transition is after midnight with the offset after
+    // the transition and at or before midnight with the offset before it.
+    let (mut earlier, mut later) = (local_midnight - after, local_midnight - before);
+    while later - earlier > 1 {
+        let middle = earlier + (later - earlier) / 2;
+        if offset_for(middle)? == before {
+            earlier = middle;
+        } else {
+            later = middle;
+        }
+    }
+    Ok(later)
+}
+
+#[inline]
+pub(crate) fn no_offset_rules() -> TemporalError {
+    TemporalError::range().with_message("TimeZone has no offset rules in the current TzDatabase.")
+}
+
 impl TzProtocol for () {
     type Context = ();
-    fn get_offset_nanos_for(&self, (): &mut ()) -> TemporalResult<BigInt> {
+    fn get_offset_nanos_for(&self, _: &Instant, (): &mut ()) -> TemporalResult<BigInt> {
         unreachable!()
     }
 
@@ -116,3 +384,178 @@ impl TzProtocol for () {
         Ok("() TimeZone".to_owned())
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use std::str::FromStr;
+
+    use super::{TimeZone, TimeZoneId, TimeZoneSlot, TzDatabase};
+
+    #[test]
+    fn time_zone_from_str() {
+        let tz = TimeZone::from_str("europe/london").unwrap();
+        assert_eq!(tz.iana.unwrap().as_str(), "Europe/London");
+        assert_eq!(tz.fixed_offset_nanoseconds(), None);
+
+        let tz = TimeZone::from_str("+05:30").unwrap();
+        assert_eq!(tz.offset, Some(330));
+        let tz = TimeZone::from_str("-0800").unwrap();
+        assert_eq!(tz.offset, Some(-480));
+        let tz = TimeZone::from_str("\u{2212}01").unwrap();
+        assert_eq!(tz.offset, Some(-60));
+
+        let tz = TimeZone::from_str("Etc/GMT+5").unwrap();
+        assert_eq!(tz.fixed_offset_nanoseconds(), Some(-18_000_000_000_000));
+
+        for s in ["+24:00", "+05:60", "+5", "+05:30:00", "Mars/Olympus_Mons"] {
+            assert!(TimeZone::from_str(s).is_err(), "{s} should not parse.");
+        }
+    }
+
+    #[test]
+    fn time_zone_id() {
+        let id = |s: &str| TimeZoneSlot::<()>::Tz(TimeZone::from_str(s).unwrap()).id(&mut ());
+        assert_eq!(id("ASIA/TOKYO").unwrap(), "Asia/Tokyo");
+        assert_eq!(id("-0330").unwrap(), "-03:30");
+        assert_eq!(id("+00").unwrap(), "+00:00");
+    }
+
+    #[test]
+    fn time_zone_database_snapshot() {
+        use std::sync::Arc;
+
+        use crate::components::{calendar::CalendarSlot, ZonedDateTime};
+        use num_bigint::BigInt;
+
+        let london = TimeZoneId::resolve("Europe/London").unwrap();
+        // 2024-03-31T01:00:00Z
+        let database = TzDatabase::new("2024a")
+            .with_zone(london, 0, &[(1_711_846_800, 3600)])
+            .unwrap();
+        let tz = TimeZone {
+            iana: Some(london),
+            offset: None,
+            rules: Some(Arc::new(database)),
+        };
+        assert_eq!(tz.database_version(), Some("2024a"));
+        assert_eq!(tz.offset_nanoseconds_for(0), Some(0));
+
+        // 2024-06-01T12:00:00Z
+        let zdt = ZonedDateTime::<(), ()>::new(
+            BigInt::from(1_717_243_200_000_000_000i64),
+            CalendarSlot::from_str("iso8601").unwrap(),
+            TimeZoneSlot::Tz(tz),
+        )
+        .unwrap();
+        assert_eq!(zdt.contextual_hour(&mut ()).unwrap(), 13);
+
+        let fixed = TimeZone::from_str("+01:00").unwrap();
+        assert_eq!(fixed.database_version(), None);
+    }
+
+    #[test]
+    fn start_of_day_skipped_midnight() {
+        use std::sync::Arc;
+
+        const SECOND: i128 = 1_000_000_000;
+        const DAY: i128 = 86_400 * SECOND;
+
+        let sao_paulo = TimeZoneId::resolve("America/Sao_Paulo").unwrap();
+        let tz = |transition: i64| TimeZone {
+            iana: Some(sao_paulo),
+            offset: None,
+            rules: Some(Arc::new(
+                TzDatabase::new("test")
+                    .with_zone(sao_paulo, -10_800, &[(transition, -7_200)])
+                    .unwrap(),
+            )),
+        };
+        // 2018-11-04 and 2018-11-05 as local nanoseconds.
+        let (nov_4, nov_5) = (17_839 * DAY, 17_840 * DAY);
+
+        // 2018-11-04T00:00-03:00 skips to 01:00-02:00, so the day starts at the transition.
+        let midnight_gap = tz(1_541_300_400);
+        assert_eq!(
+            midnight_gap.start_of_day_nanoseconds(nov_4),
+            Some(1_541_300_400 * SECOND)
+        );
+        assert_eq!(
+            midnight_gap.start_of_day_nanoseconds(nov_5),
+            Some(nov_5 + 2 * 3_600 * SECOND)
+        );
+
+        // A gap from 23:30 to 00:30 starts the day at 00:30.
+        let early_gap = tz(1_541_298_600);
+        assert_eq!(
+            early_gap.start_of_day_nanoseconds(nov_4),
+            Some(1_541_298_600 * SECOND)
+        );
+
+        // An ambiguous midnight starts the day at its earlier instant.
+        let overlap = TimeZone {
+            iana: Some(sao_paulo),
+            offset: None,
+            rules: Some(Arc::new(
+                TzDatabase::new("test")
+                    .with_zone(sao_paulo, -7_200, &[(1_541_300_400, -10_800)])
+                    .unwrap(),
+            )),
+        };
+        assert_eq!(
+            overlap.start_of_day_nanoseconds(nov_4),
+            Some(nov_4 + 2 * 3_600 * SECOND)
+        );
+    }
+
+    #[test]
+    fn protocol_offsets_depend_on_instant() {
+        use num_bigint::BigInt;
+
+        use super::{Instant, TemporalResult, TzProtocol};
+
+        const HOUR: i64 = 3_600_000_000_000;
+
+        /// A time zone that moves from -05:00 to -04:00 at the epoch.
+        #[derive(Clone)]
+        struct Transition;
+
+        impl TzProtocol for Transition {
+            type Context = ();
+            fn get_offset_nanos_for(
+                &self,
+                instant: &Instant,
+                (): &mut (),
+            ) -> TemporalResult<BigInt> {
+                let offset = if instant.nanos < BigInt::from(0) {
+                    -5
+                } else {
+                    -4
+                };
+                Ok(BigInt::from(offset * HOUR))
+            }
+
+            fn get_possible_instant_for(&self, (): &mut ()) -> TemporalResult<Vec<Instant>> {
+                unreachable!()
+            }
+
+            fn id(&self, (): &mut ()) -> TemporalResult<String> {
+                Ok("Transition".to_owned())
+            }
+        }
+
+        let tz = TimeZoneSlot::Protocol(Transition);
+        let offset_at = |nanos: i64| {
+            tz.get_offset_nanos_for(&Instant::new(BigInt::from(nanos)).unwrap(), &mut ())
+                .unwrap()
+        };
+        assert_eq!(offset_at(-1), BigInt::from(-5 * HOUR));
+        assert_eq!(offset_at(0), BigInt::from(-4 * HOUR));
+
+        // 1970-01-01T00:00 is after the transition, and the skipped 1969-12-31T19:30 moves
+        // forward by the length of the gap.
+        let epoch = |local: i64| tz.get_epoch_nanoseconds_for(i128::from(local), &mut ());
+        assert_eq!(epoch(0).unwrap(), i128::from(4 * HOUR));
+        assert_eq!(epoch(-9 * HOUR / 2).unwrap(), i128::from(HOUR / 2));
+        assert_eq!(epoch(-6 * HOUR).unwrap(), i128::from(-HOUR));
+    }
+}
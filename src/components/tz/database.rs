@@ -0,0 +1,286 @@
+//! This module implements a hot-reloadable store of time zone offset rules.
+//!
+//! A `TzDatabase` is an immutable snapshot of the UTC offset transitions of a set of IANA
+//! time zones. A new version can be installed at any time with `TzDatabase::install`, which
+//! atomically replaces the current snapshot while existing snapshots stay alive for as long
+//! as they are referenced.
+//!
+//! Readers cache the current snapshot per thread along with the generation it was read at.
+//! The fast path only loads the global generation counter and compares it to the cached one,
+//! so readers never take a lock unless a new version was installed since their last read.
+
+use std::{
+    cell::RefCell,
+    sync::{
+        atomic::{AtomicU64, Ordering},
+        Arc, OnceLock, PoisonError, RwLock,
+    },
+};
+
+use rustc_hash::FxHashMap;
+
+use crate::{TemporalError, TemporalResult};
+
+use super::TimeZoneId;
+
+/// An immutable snapshot of time zone offset rules.
+#[derive(Default)]
+pub struct TzDatabase {
+    version: Box<str>,
+    zones: FxHashMap<TimeZoneId, ZoneRules>,
+}
+
+/// The UTC offsets of a single time zone.
+struct ZoneRules {
+    /// The offset in seconds before the first transition.
+    initial_offset: i32,
+    /// The epoch seconds of each transition, sorted in ascending order.
+    transitions: Box<[i64]>,
+    /// The offset in seconds that begins at the transition of the same index.
+    offsets: Box<[i32]>,
+}
+
+impl core::fmt::Debug for TzDatabase {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        f.debug_struct("TzDatabase")
+            .field("version", &self.version)
+            .field("zones", &self.zones.len())
+            .finish()
+    }
+}
+
+// ==== Public API ====
+
+impl TzDatabase {
+    /// Creates a new empty `TzDatabase` with the provided version, e.g. `"2024a"`.
+    #[must_use]
+    pub fn new(version: &str) -> Self {
+        Self {
+            version: version.into(),
+            zones: FxHashMap::default(),
+        }
+    }
+
+    /// Adds the rules of a time zone to this `TzDatabase`, replacing any existing rules.
+    ///
+    /// `initial_offset` is the UTC offset in seconds before the first transition, and each
+    /// transition is a pair of the epoch seconds it occurs at and the UTC offset in seconds
+    /// that begins at it. Transitions must be sorted by their epoch seconds.
+    pub fn with_zone(
+        mut self,
+        id: TimeZoneId,
+        initial_offset: i32,
+        transitions: &[(i64, i32)],
+    ) -> TemporalResult<Self> {
+        const MAX_OFFSET: u32 = 24 * 3600;
+        let valid_offset = |offset: i32| offset.unsigned_abs() < MAX_OFFSET;
+        if !valid_offset(initial_offset)
+            || !transitions.iter().all(|(_, offset)| valid_offset(*offset))
+        {
+            return Err(
+                TemporalError::range().with_message("TimeZone offsets must be less than a day.")
+            );
+        }
+        if !transitions.windows(2).all(|w| w[0].0 < w[1].0) {
+            return Err(TemporalError::range()
+                .with_message("TimeZone transitions must be sorted by their epoch seconds."));
+        }
+
+        self.zones.insert(
+            id,
+            ZoneRules {
+                initial_offset,
+                transitions: transitions.iter().map(|(time, _)| *time).collect(),
+                offsets: transitions.iter().map(|(_, offset)| *offset).collect(),
+            },
+        );
+        Ok(self)
+    }
+
+    /// Returns the version of this `TzDatabase`.
+    #[inline]
+    #[must_use]
+    pub fn version(&self) -> &str {
+        &self.version
+    }
+
+    /// Returns whether this `TzDatabase` has rules for the provided time zone.
+    #[inline]
+    #[must_use]
+    pub fn contains(&self, id: TimeZoneId) -> bool {
+        self.zones.contains_key(&id)
+    }
+
+    /// Returns the UTC offset in seconds of a time zone at the provided epoch seconds, or
+    /// `None` if this `TzDatabase` has no rules for the time zone.
+    #[must_use]
+    pub fn offset_seconds_for(&self, id: TimeZoneId, epoch_seconds: i64) -> Option<i32> {
+        let rules = self.zones.get(&id)?;
+        // The number of transitions at or before `epoch_seconds`.
+        let count = rules
+            .transitions
+            .partition_point(|time| *time <= epoch_seconds);
+        Some(match count.checked_sub(1) {
+            Some(index) => rules.offsets[index],
+            None => rules.initial_offset,
+        })
+    }
+
+    /// Atomically installs a new current `TzDatabase`, returning the previous one.
+    ///
+    /// Snapshots that were previously returned by `current` are unaffected.
+    pub fn install(database: Self) -> Arc<Self> {
+        let mut current = store().write().unwrap_or_else(PoisonError::into_inner);
+        let previous = std::mem::replace(&mut *current, Arc::new(database));
+        // NOTE: The generation is bumped while the lock is held, so a reader that observes the
+        // new generation always reads the new snapshot.
+        GENERATION.fetch_add(1, Ordering::Release);
+        previous
+    }
+
+    /// Returns a snapshot of the current `TzDatabase`.
+    #[must_use]
+    pub fn current() -> Arc<Self> {
+        Self::with_current(Arc::clone)
+    }
+
+    /// Calls `f` with the current `TzDatabase` without taking a new reference to it.
+    pub fn with_current<R>(f: impl FnOnce(&Arc<Self>) -> R) -> R {
+        let generation = GENERATION.load(Ordering::Acquire);
+        CACHED.with(|cached| {
+            // NOTE: `try_borrow` keeps a nested call from `f` from panicking.
+            if let Ok(cached) = cached.try_borrow() {
+                if let Some((cached_generation, database)) = &*cached {
+                    if *cached_generation == generation {
+                        return f(database);
+                    }
+                }
+            }
+            let database = store()
+                .read()
+                .unwrap_or_else(PoisonError::into_inner)
+                .clone();
+            if let Ok(mut cached) = cached.try_borrow_mut() {
+                *cached = Some((generation, Arc::clone(&database)));
+            }
+            f(&database)
+        })
+    }
+}
+
+// ==== Global store ====
+
+/// Incremented every time a new `TzDatabase` is installed.
+static GENERATION: AtomicU64 = AtomicU64::new(0);
+
+thread_local! {
+    static CACHED: RefCell<Option<(u64, Arc<TzDatabase>)>> = const { RefCell::new(None) };
+}
+
+fn store() -> &'static RwLock<Arc<TzDatabase>> {
+    static STORE: OnceLock<RwLock<Arc<TzDatabase>>> = OnceLock::new();
+    STORE.get_or_init(|| RwLock::new(Arc::new(TzDatabase::default())))
+}
+
+#[cfg(test)]
+mod tests {
+    use std::{
+        str::FromStr,
+        sync::{Mutex, PoisonError},
+    };
+
+    use super::{TimeZoneId, TzDatabase};
+    use crate::components::ZonedDateTime;
+
+    /// Serializes the tests that install a new current `TzDatabase`.
+    static INSTALL: Mutex<()> = Mutex::new(());
+
+    #[test]
+    fn zone_offsets() {
+        let london = TimeZoneId::resolve("Europe/London").unwrap();
+        let paris = TimeZoneId::resolve("Europe/Paris").unwrap();
+        // 2024-03-31T01:00:00Z and 2024-10-27T01:00:00Z
+        let database = TzDatabase::new("test")
+            .with_zone(london, 0, &[(1_711_846_800, 3600), (1_729_990_800, 0)])
+            .unwrap();
+
+        assert_eq!(database.version(), "test");
+        assert_eq!(database.offset_seconds_for(london, 0), Some(0));
+        assert_eq!(database.offset_seconds_for(london, 1_711_846_799), Some(0));
+        assert_eq!(
+            database.offset_seconds_for(london, 1_711_846_800),
+            Some(3600)
+        );
+        assert_eq!(database.offset_seconds_for(london, 1_729_990_800), Some(0));
+        assert_eq!(database.offset_seconds_for(paris, 0), None);
+
+        assert!(TzDatabase::new("test")
+            .with_zone(paris, 3600, &[(10, 7200), (10, 3600)])
+            .is_err());
+        assert!(TzDatabase::new("test")
+            .with_zone(paris, 86_400, &[])
+            .is_err());
+    }
+
+    #[test]
+    fn install_keeps_snapshots() {
+        let _guard = INSTALL.lock().unwrap_or_else(PoisonError::into_inner);
+        let tokyo = TimeZoneId::resolve("Asia/Tokyo").unwrap();
+        let first = TzDatabase::new("install-1")
+            .with_zone(tokyo, 32_400, &[])
+            .unwrap();
+        TzDatabase::install(first);
+        let snapshot = TzDatabase::current();
+
+        TzDatabase::install(TzDatabase::new("install-2"));
+        // The earlier snapshot keeps its rules after the swap.
+        assert_eq!(snapshot.offset_seconds_for(tokyo, 0), Some(32_400));
+        assert!(!TzDatabase::current().contains(tokyo));
+
+        // Other threads observe the swap as well.
+        let version = std::thread::spawn(|| TzDatabase::current().version().to_owned())
+            .join()
+            .unwrap();
+        assert!(version.starts_with("install-"));
+    }
+
+    #[test]
+    fn installed_rules_resolve_named_zones() {
+        let _guard = INSTALL.lock().unwrap_or_else(PoisonError::into_inner);
+        let new_york = TimeZoneId::resolve("America/New_York").unwrap();
+        // 2024-03-10T07:00:00Z and 2024-11-03T06:00:00Z
+        let database = TzDatabase::new("install-new-york")
+            .with_zone(
+                new_york,
+                -18_000,
+                &[(1_710_054_000, -14_400), (1_730_613_600, -18_000)],
+            )
+            .unwrap();
+        TzDatabase::install(database);
+
+        let parse = |s: &str| ZonedDateTime::<(), ()>::from_str(s);
+        let zdt = parse("2024-07-01T12:00:00-04:00[America/New_York]").unwrap();
+        assert_eq!(zdt.epoch_seconds(), 1_719_849_600.0);
+        assert_eq!(zdt.contextual_hour(&mut ()).unwrap(), 12);
+        assert!(parse("2024-07-01T12:00:00-05:00[America/New_York]").is_err());
+
+        // A local time without an offset uses the offset of the time zone.
+        let zdt = parse("2024-01-15T12:00[America/New_York]").unwrap();
+        assert_eq!(zdt.epoch_seconds(), 1_705_338_000.0);
+        // A skipped local time is moved forward by the length of the gap.
+        let zdt = parse("2024-03-10T02:30[America/New_York]").unwrap();
+        assert_eq!(zdt.epoch_seconds(), 1_710_055_800.0);
+        // An ambiguous local time resolves to the earlier instant unless an offset is given.
+        let zdt = parse("2024-11-03T01:30[America/New_York]").unwrap();
+        assert_eq!(zdt.epoch_seconds(), 1_730_611_800.0);
+        let zdt = parse("2024-11-03T01:30-05:00[America/New_York]").unwrap();
+        assert_eq!(zdt.epoch_seconds(), 1_730_615_400.0);
+
+        // 2024-11-03 is 25 hours long.
+        let day = zdt.day_interval(&mut ()).unwrap();
+        assert_eq!(
+            day.end_epoch_nanoseconds() - day.start_epoch_nanoseconds(),
+            90_000_000_000_000
+        );
+    }
+}
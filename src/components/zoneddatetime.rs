@@ -1,15 +1,20 @@
 //! This module implements `ZonedDateTime` and any directly related algorithms.
 
+use std::str::FromStr;
+
 use num_bigint::BigInt;
 use tinystr::TinyStr4;
 
 use crate::{
     components::{
         calendar::{CalendarDateLike, CalendarProtocol, CalendarSlot},
-        tz::TimeZoneSlot,
-        Instant,
+        tz::{no_offset_rules, TimeZone, TimeZoneSlot},
+        Instant, InstantInterval,
     },
-    TemporalResult,
+    iso::{IsoDate, IsoDateSlots, IsoDateTime, IsoTime},
+    options::{ArithmeticOverflow, OffsetDisambiguation},
+    parsers::{has_utc_designator, parse_zoned_date_time, utc_offset_nanoseconds},
+    utils, TemporalError, TemporalResult, TemporalUnwrap, NS_PER_DAY,
 };
 
 use super::tz::TzProtocol;
@@ -56,6 +61,80 @@ impl<C: CalendarProtocol, Z: TzProtocol> ZonedDateTime<C, Z> {
         Ok(Self::new_unchecked(instant, calendar, tz))
     }
 
+    /// Parses a `ZonedDateTime` string, resolving a mismatch between the string's UTC offset
+    /// and its time zone annotation according to the provided `OffsetDisambiguation`.
+    pub fn from_str_with_offset_option(
+        source: &str,
+        offset_option: OffsetDisambiguation,
+    ) -> TemporalResult<Self> {
+        let record = parse_zoned_date_time(source)?;
+
+        let annotation = record.tz.temporal_unwrap()?;
+        let tz = TimeZone::from_annotation(&annotation.tz)?;
+
+        let calendar = CalendarSlot::from_str(record.calendar.unwrap_or("iso8601"))?;
+
+        let date = record.date.temporal_unwrap()?;
+        let date = IsoDate::new(
+            date.year,
+            date.month.into(),
+            date.day.into(),
+            ArithmeticOverflow::Reject,
+        )?;
+        // NOTE: A string without a time is the start of its day in the time zone, which is
+        // after midnight when an offset transition skips midnight.
+        let Some(time) = record.time else {
+            let midnight = IsoDateTime::new_unchecked(date, IsoTime::default()).as_nanoseconds();
+            let start = tz
+                .start_of_day_nanoseconds(midnight)
+                .ok_or_else(no_offset_rules)?;
+            let instant = Instant::new(BigInt::from(start))?;
+            return Ok(Self::new_unchecked(instant, calendar, TimeZoneSlot::Tz(tz)));
+        };
+        let time = IsoTime::from_time_record(time.hour, time.minute, time.second, time.nanosecond)?;
+        let local_nanos = IsoDateTime::new_unchecked(date, time).as_nanoseconds();
+
+        let tz_offset = || {
+            tz.offset_nanoseconds_for_local(local_nanos)
+                .ok_or_else(no_offset_rules)
+        };
+
+        // NOTE: A `Z` designator is an exact time, so its offset is used for any offsetOption.
+        let exact = has_utc_designator(&record, source);
+        let offset = match (
+            record.offset.as_ref().map(utc_offset_nanoseconds),
+            offset_option,
+        ) {
+            // 2. If offsetBehaviour is exact, or offsetBehaviour is option and offsetOption is "use", then
+            (Some(offset), _) if exact => offset,
+            (Some(offset), OffsetDisambiguation::Use) => offset,
+            // 1. If offsetBehaviour is wall, or offsetBehaviour is option and offsetOption is "ignore", then
+            (None, _) | (Some(_), OffsetDisambiguation::Ignore) => tz_offset()?,
+            // 5. Let possibleInstants be ? GetPossibleInstantsFor(timeZone, dateTime).
+            // 6. For each element candidate of possibleInstants, do
+            (Some(offset), OffsetDisambiguation::Prefer | OffsetDisambiguation::Reject) => {
+                let matches = tz
+                    .offset_matches_local(local_nanos, offset)
+                    .ok_or_else(no_offset_rules)?;
+                // a. If candidateNanoseconds = offsetNanoseconds, return candidate.
+                if matches {
+                    offset
+                // 7. If offsetOption is "reject", throw a RangeError exception.
+                } else if matches!(offset_option, OffsetDisambiguation::Reject) {
+                    return Err(TemporalError::range()
+                        .with_message("Offset does not match the provided TimeZone."));
+                // 8. Let instant be ? DisambiguatePossibleInstants(possibleInstants, timeZone, dateTime, disambiguation).
+                } else {
+                    tz_offset()?
+                }
+            }
+        };
+
+        let instant = Instant::new(BigInt::from(local_nanos - offset))?;
+
+        Ok(Self::new_unchecked(instant, calendar, TimeZoneSlot::Tz(tz)))
+    }
+
     /// Returns `ZonedDateTime`'s Calendar.
     #[inline]
     #[must_use]
@@ -183,13 +262,70 @@ where
             .get_datetime_for(&self.instant, &self.calendar, context)?;
         Ok(dt.nanosecond())
     }
+
+    /// Returns the `InstantInterval` spanning the local calendar day of this `ZonedDateTime`.
+    pub fn day_interval(&self, context: &mut C::Context) -> TemporalResult<InstantInterval> {
+        let dt = self
+            .tz
+            .get_datetime_for(&self.instant, &self.calendar, context)?;
+        self.local_days_interval(dt.iso_date(), 0, 1, context)
+    }
+
+    /// Returns the `InstantInterval` spanning the local calendar month of this
+    /// `ZonedDateTime`, e.g. all of local March for a `ZonedDateTime` in March.
+    pub fn month_interval(&self, context: &mut C::Context) -> TemporalResult<InstantInterval> {
+        let dt = self
+            .tz
+            .get_datetime_for(&self.instant, &self.calendar, context)?;
+        let date_like = CalendarDateLike::DateTime(dt);
+        let day = self.calendar.day(&date_like, context)?;
+        let days_in_month = self.calendar.days_in_month(&date_like, context)?;
+        self.local_days_interval(
+            date_like.as_iso_date(),
+            i64::from(day) - 1,
+            i64::from(days_in_month),
+            context,
+        )
+    }
+
+    /// Returns the `InstantInterval` of `days` local days beginning `days_before` days before
+    /// the provided local date.
+    ///
+    /// The start and end of the interval are resolved with the offset of the `TimeZone` at
+    /// each of them, so an interval spanning an offset transition is not a whole number of days.
+    fn local_days_interval(
+        &self,
+        date: IsoDate,
+        days_before: i64,
+        days: i64,
+        context: &mut C::Context,
+    ) -> TemporalResult<InstantInterval> {
+        let start_day =
+            utils::epoch_days_from_gregorian_date(date.year, date.month, date.day) - days_before;
+        let local_start = i128::from(start_day) * i128::from(NS_PER_DAY);
+        let local_end = local_start + i128::from(days) * i128::from(NS_PER_DAY);
+        InstantInterval::from_epoch_nanoseconds(
+            self.tz.get_epoch_nanoseconds_for(local_start, context)?,
+            self.tz.get_epoch_nanoseconds_for(local_end, context)?,
+        )
+    }
+}
+
+// ==== Trait impls ====
+
+impl<C: CalendarProtocol, Z: TzProtocol> FromStr for ZonedDateTime<C, Z> {
+    type Err = TemporalError;
+
+    fn from_str(s: &str) -> Result<Self, Self::Err> {
+        Self::from_str_with_offset_option(s, OffsetDisambiguation::Reject)
+    }
 }
 
 #[cfg(test)]
 mod tests {
     use std::str::FromStr;
 
-    use crate::components::tz::TimeZone;
+    use crate::{components::tz::TimeZone, options::OffsetDisambiguation};
     use num_bigint::BigInt;
 
     use super::{CalendarSlot, TimeZoneSlot, ZonedDateTime};
@@ -204,6 +340,7 @@ mod tests {
             TimeZoneSlot::Tz(TimeZone {
                 iana: None,
                 offset: Some(0),
+                rules: None,
             }),
         )
         .unwrap();
@@ -221,6 +358,7 @@ mod tests {
             TimeZoneSlot::Tz(TimeZone {
                 iana: None,
                 offset: Some(-300),
+                rules: None,
             }),
         )
         .unwrap();
@@ -232,4 +370,104 @@ mod tests {
         assert_eq!(zdt_minus_five.contextual_minute(&mut ()).unwrap(), 49);
         assert_eq!(zdt_minus_five.contextual_second(&mut ()).unwrap(), 12);
     }
+
+    #[test]
+    fn zdt_from_str() {
+        let zdt = ZonedDateTime::<(), ()>::from_str("2023-11-30T01:49:12+00:00[UTC]").unwrap();
+        assert_eq!(
+            zdt.instant.nanos,
+            BigInt::from(1_701_308_952_000_000_000i64)
+        );
+        assert_eq!(zdt.tz().id(&mut ()).unwrap(), "UTC");
+
+        let zdt = ZonedDateTime::<(), ()>::from_str("2023-11-29T20:49:12.5-05:00[-05:00]").unwrap();
+        assert_eq!(
+            zdt.instant.nanos,
+            BigInt::from(1_701_308_952_500_000_000i64)
+        );
+        assert_eq!(zdt.contextual_hour(&mut ()).unwrap(), 20);
+
+        // Time zone annotations are resolved case-insensitively.
+        let zdt = ZonedDateTime::<(), ()>::from_str("2023-11-29T20:49:12[etc/gmt+5]").unwrap();
+        assert_eq!(
+            zdt.instant.nanos,
+            BigInt::from(1_701_308_952_000_000_000i64)
+        );
+        assert_eq!(zdt.tz().id(&mut ()).unwrap(), "Etc/GMT+5");
+
+        // A string without a time is the start of its day.
+        let zdt = ZonedDateTime::<(), ()>::from_str("2023-11-29[-05:00]").unwrap();
+        assert_eq!(
+            zdt.instant.nanos,
+            BigInt::from(1_701_234_000_000_000_000i64)
+        );
+
+        let invalid_strings = [
+            "2023-11-30T01:49:12+00:00",
+            "2023-11-30T01:49:12[Mars/Olympus_Mons]",
+            "2023-11-30T01:49:12[+00:00:01]",
+            "2023-02-30T01:49:12[UTC]",
+        ];
+        for s in invalid_strings {
+            assert!(
+                ZonedDateTime::<(), ()>::from_str(s).is_err(),
+                "{s} should not parse."
+            );
+        }
+    }
+
+    #[test]
+    fn zdt_local_intervals() {
+        let zdt = ZonedDateTime::<(), ()>::from_str("2024-03-01T00:30:00+01:00[+01:00]").unwrap();
+
+        // 2024-03-01T00:00:00+01:00 to 2024-04-01T00:00:00+01:00
+        let march = zdt.month_interval(&mut ()).unwrap();
+        assert_eq!(march.start_epoch_nanoseconds(), 1_709_247_600_000_000_000);
+        assert_eq!(march.end_epoch_nanoseconds(), 1_711_926_000_000_000_000);
+
+        let day = zdt.day_interval(&mut ()).unwrap();
+        assert_eq!(day.start_epoch_nanoseconds(), 1_709_247_600_000_000_000);
+        assert_eq!(day.end_epoch_nanoseconds(), 1_709_334_000_000_000_000);
+        assert!(march.contains_interval(&day));
+        assert!(day.contains(&zdt.instant));
+    }
+
+    #[test]
+    fn zdt_from_str_offset_option() {
+        let source = "2023-11-30T01:49:12+01:00[+00:00]";
+        let parse = |option| ZonedDateTime::<(), ()>::from_str_with_offset_option(source, option);
+
+        assert!(parse(OffsetDisambiguation::Reject).is_err());
+        assert_eq!(
+            parse(OffsetDisambiguation::Use).unwrap().instant.nanos,
+            BigInt::from(1_701_305_352_000_000_000i64)
+        );
+        assert_eq!(
+            parse(OffsetDisambiguation::Prefer).unwrap().instant.nanos,
+            BigInt::from(1_701_308_952_000_000_000i64)
+        );
+        assert_eq!(
+            parse(OffsetDisambiguation::Ignore).unwrap().instant.nanos,
+            BigInt::from(1_701_308_952_000_000_000i64)
+        );
+
+        // A `Z` designator is an exact time that is not checked against the time zone.
+        let source = "2023-11-30T01:49:12Z[Etc/GMT+5]";
+        for option in [
+            OffsetDisambiguation::Reject,
+            OffsetDisambiguation::Prefer,
+            OffsetDisambiguation::Ignore,
+            OffsetDisambiguation::Use,
+        ] {
+            let zdt = ZonedDateTime::<(), ()>::from_str_with_offset_option(source, option).unwrap();
+            assert_eq!(
+                zdt.instant.nanos,
+                BigInt::from(1_701_308_952_000_000_000i64)
+            );
+            assert_eq!(zdt.contextual_hour(&mut ()).unwrap(), 20);
+        }
+
+        // A `+00:00` offset is not a `Z` designator, so it is checked against the time zone.
+        assert!(ZonedDateTime::<(), ()>::from_str("2023-11-30T01:49:12+00:00[Etc/GMT+5]").is_err());
+    }
 }
@@ -521,6 +521,294 @@ impl From<IsoDate> for TemporalFields {
     }
 }
 
+impl From<DateFields> for TemporalFields {
+    fn from(value: DateFields) -> Self {
+        let mut bit_map = FieldMap::empty();
+        bit_map.set(FieldMap::YEAR, value.year.is_some());
+        bit_map.set(FieldMap::MONTH, value.month.is_some());
+        bit_map.set(FieldMap::MONTH_CODE, value.month_code.is_some());
+        bit_map.set(FieldMap::DAY, value.day.is_some());
+        bit_map.set(FieldMap::ERA, value.era.is_some());
+        bit_map.set(FieldMap::ERA_YEAR, value.era_year.is_some());
+        TemporalFields {
+            bit_map,
+            year: value.year,
+            month: value.month,
+            month_code: value.month_code,
+            day: value.day,
+            era: value.era,
+            era_year: value.era_year,
+            ..Default::default()
+        }
+    }
+}
+
+// ==== DateFields ====
+
+/// The typed date fields of a property bag, i.e. the fields read by `Temporal.PlainDate.from`.
+///
+/// Unlike `TemporalFields`, `DateFields` are set directly rather than by string key, and an
+/// ISO 8601 date is resolved from them with a single validation.
+#[derive(Debug, Default, Clone, Copy, PartialEq, Eq)]
+pub struct DateFields {
+    /// The `year` field.
+    pub year: Option<i32>,
+    /// The `month` field.
+    pub month: Option<i32>,
+    /// The `monthCode` field.
+    pub month_code: Option<TinyStr4>,
+    /// The `day` field.
+    pub day: Option<i32>,
+    /// The `era` field.
+    pub era: Option<TinyStr16>,
+    /// The `eraYear` field.
+    pub era_year: Option<i32>,
+}
+
+impl DateFields {
+    /// Creates a new `DateFields` with every field undefined.
+    #[inline]
+    #[must_use]
+    pub const fn new() -> Self {
+        Self {
+            year: None,
+            month: None,
+            month_code: None,
+            day: None,
+            era: None,
+            era_year: None,
+        }
+    }
+
+    /// Sets the `year` field.
+    #[inline]
+    #[must_use]
+    pub const fn with_year(mut self, year: i32) -> Self {
+        self.year = Some(year);
+        self
+    }
+
+    /// Sets the `month` field.
+    #[inline]
+    #[must_use]
+    pub const fn with_month(mut self, month: i32) -> Self {
+        self.month = Some(month);
+        self
+    }
+
+    /// Sets the `monthCode` field.
+    #[inline]
+    #[must_use]
+    pub const fn with_month_code(mut self, month_code: TinyStr4) -> Self {
+        self.month_code = Some(month_code);
+        self
+    }
+
+    /// Sets the `day` field.
+    #[inline]
+    #[must_use]
+    pub const fn with_day(mut self, day: i32) -> Self {
+        self.day = Some(day);
+        self
+    }
+
+    /// Sets the `era` field.
+    #[inline]
+    #[must_use]
+    pub const fn with_era(mut self, era: TinyStr16) -> Self {
+        self.era = Some(era);
+        self
+    }
+
+    /// Sets the `eraYear` field.
+    #[inline]
+    #[must_use]
+    pub const fn with_era_year(mut self, era_year: i32) -> Self {
+        self.era_year = Some(era_year);
+        self
+    }
+
+    /// Returns whether every field is undefined.
+    #[inline]
+    #[must_use]
+    pub const fn is_empty(&self) -> bool {
+        self.year.is_none()
+            && self.month.is_none()
+            && self.month_code.is_none()
+            && self.day.is_none()
+            && self.era.is_none()
+            && self.era_year.is_none()
+    }
+
+    /// Merges `other` into these fields, with the defined fields of `other` taking precedence.
+    ///
+    /// A `month` or `monthCode` in `other` replaces both of these fields, and a `year`, `era`,
+    /// or `eraYear` in `other` replaces all three of them.
+    #[must_use]
+    pub(crate) fn merge(&self, other: &Self) -> Self {
+        let mut result = *self;
+        if other.month.is_some() || other.month_code.is_some() {
+            result.month = other.month;
+            result.month_code = other.month_code;
+        }
+        if other.year.is_some() || other.era.is_some() || other.era_year.is_some() {
+            result.year = other.year;
+            result.era = other.era;
+            result.era_year = other.era_year;
+        }
+        if other.day.is_some() {
+            result.day = other.day;
+        }
+        result
+    }
+
+    /// Checks that the `month` and `day` fields are positive integers.
+    ///
+    /// Equivalent: the `ToPositiveIntegerWithTruncation` conversion of `month` and `day` in
+    /// `PrepareTemporalFields`, which throws a `RangeError` for any overflow.
+    pub(crate) fn validate_positive(&self) -> TemporalResult<()> {
+        if self.month.is_some_and(|month| month < 1) || self.day.is_some_and(|day| day < 1) {
+            return Err(
+                TemporalError::range().with_message("month and day must be positive integers.")
+            );
+        }
+        Ok(())
+    }
+
+    /// Returns the required `year` and `day` fields of an ISO 8601 date.
+    pub(crate) fn iso_year_and_day(&self) -> TemporalResult<(i32, i32)> {
+        match (self.year, self.day) {
+            (Some(year), Some(day)) => Ok((year, day)),
+            (None, _) => Err(TemporalError::r#type().with_message("year field is required.")),
+            (_, None) => Err(TemporalError::r#type().with_message("day field is required.")),
+        }
+    }
+
+    /// Resolves the ISO 8601 month from the `month` and `monthCode` fields.
+    pub(crate) fn iso_month(&self) -> TemporalResult<i32> {
+        let Some(month_code) = self.month_code else {
+            return self.month.ok_or_else(|| {
+                TemporalError::range()
+                    .with_message("month and monthCode values cannot both be undefined.")
+            });
+        };
+
+        // NOTE: Only "M01" through "M12" are valid ISO 8601 month codes.
+        let month_code_integer = match month_code.as_str().as_bytes() {
+            [b'M', b'0', ones @ b'1'..=b'9'] => i32::from(ones - b'0'),
+            [b'M', b'1', ones @ b'0'..=b'2'] => 10 + i32::from(ones - b'0'),
+            _ => {
+                return Err(TemporalError::range()
+                    .with_message("monthCode is not within the valid values."))
+            }
+        };
+
+        match self.month {
+            Some(month) if month != month_code_integer => {
+                Err(TemporalError::range().with_message("month and monthCode cannot be resolved."))
+            }
+            _ => Ok(month_code_integer),
+        }
+    }
+}
+
+// ==== TimeFields ====
+
+/// The typed time fields of a property bag.
+///
+/// Fields that are undefined keep their current value when used with `Time::with`.
+#[derive(Debug, Default, Clone, Copy, PartialEq, Eq)]
+pub struct TimeFields {
+    /// The `hour` field.
+    pub hour: Option<i32>,
+    /// The `minute` field.
+    pub minute: Option<i32>,
+    /// The `second` field.
+    pub second: Option<i32>,
+    /// The `millisecond` field.
+    pub millisecond: Option<i32>,
+    /// The `microsecond` field.
+    pub microsecond: Option<i32>,
+    /// The `nanosecond` field.
+    pub nanosecond: Option<i32>,
+}
+
+impl TimeFields {
+    /// Creates a new `TimeFields` with every field undefined.
+    #[inline]
+    #[must_use]
+    pub const fn new() -> Self {
+        Self {
+            hour: None,
+            minute: None,
+            second: None,
+            millisecond: None,
+            microsecond: None,
+            nanosecond: None,
+        }
+    }
+
+    /// Sets the `hour` field.
+    #[inline]
+    #[must_use]
+    pub const fn with_hour(mut self, hour: i32) -> Self {
+        self.hour = Some(hour);
+        self
+    }
+
+    /// Sets the `minute` field.
+    #[inline]
+    #[must_use]
+    pub const fn with_minute(mut self, minute: i32) -> Self {
+        self.minute = Some(minute);
+        self
+    }
+
+    /// Sets the `second` field.
+    #[inline]
+    #[must_use]
+    pub const fn with_second(mut self, second: i32) -> Self {
+        self.second = Some(second);
+        self
+    }
+
+    /// Sets the `millisecond` field.
+    #[inline]
+    #[must_use]
+    pub const fn with_millisecond(mut self, millisecond: i32) -> Self {
+        self.millisecond = Some(millisecond);
+        self
+    }
+
+    /// Sets the `microsecond` field.
+    #[inline]
+    #[must_use]
+    pub const fn with_microsecond(mut self, microsecond: i32) -> Self {
+        self.microsecond = Some(microsecond);
+        self
+    }
+
+    /// Sets the `nanosecond` field.
+    #[inline]
+    #[must_use]
+    pub const fn with_nanosecond(mut self, nanosecond: i32) -> Self {
+        self.nanosecond = Some(nanosecond);
+        self
+    }
+
+    /// Returns whether every field is undefined.
+    #[inline]
+    #[must_use]
+    pub const fn is_empty(&self) -> bool {
+        self.hour.is_none()
+            && self.minute.is_none()
+            && self.second.is_none()
+            && self.millisecond.is_none()
+            && self.microsecond.is_none()
+            && self.nanosecond.is_none()
+    }
+}
+
 /// Iterator over `TemporalFields` keys.
 pub struct Keys {
     iter: bitflags::iter::Iter<FieldMap>,
@@ -0,0 +1,488 @@
+//! This module implements locale-aware formatting of the Temporal components.
+//!
+//! Creating a locale-specific formatter loads and resolves the locale's patterns and symbols,
+//! which is far more expensive than formatting a value with it. `LocaleFormatter`s are
+//! therefore cached in a bounded, thread-safe cache keyed by the locale, the calendar, and the
+//! `FormatOptions`, and format into a caller provided buffer that can be reused across calls.
+//!
+//! The `locale_formatting` feature is required to use this module.
+
+use core::fmt::Write;
+use std::{
+    collections::VecDeque,
+    sync::{Arc, Mutex, MutexGuard, OnceLock, PoisonError},
+};
+
+use icu_calendar::{types::Time as IcuTime, AnyCalendar, AnyCalendarKind, DateTime as IcuDateTime};
+use icu_datetime::{
+    input::DateTimeInput,
+    options::length::{Bag, Date as DateLength, Time as TimeLength},
+    DateTimeFormatter,
+};
+use icu_locid::{extensions::unicode::key, Locale};
+use rustc_hash::FxHashMap;
+
+use crate::{
+    components::{
+        calendar::{CalendarProtocol, CalendarSlot},
+        Date, DateTime, Time,
+    },
+    iso::{IsoDate, IsoTime},
+    TemporalError, TemporalResult,
+};
+
+/// The default number of formatters held by the formatter cache.
+pub const DEFAULT_FORMATTER_CACHE_CAPACITY: usize = 64;
+
+/// The length of a formatted date or time.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub enum FormatLength {
+    /// The full length, e.g. "Friday, March 15, 2024".
+    Full,
+    /// The long length, e.g. "March 15, 2024".
+    Long,
+    /// The medium length, e.g. "Mar 15, 2024".
+    Medium,
+    /// The short length, e.g. "3/15/24".
+    Short,
+}
+
+/// The options used to create a `LocaleFormatter`.
+#[derive(Debug, Default, Clone, Copy, PartialEq, Eq, Hash)]
+pub struct FormatOptions {
+    /// The length of the date, or `None` to not format the date.
+    pub date: Option<FormatLength>,
+    /// The length of the time, or `None` to not format the time.
+    pub time: Option<FormatLength>,
+}
+
+impl FormatOptions {
+    /// Creates new `FormatOptions` that only format the date.
+    #[inline]
+    #[must_use]
+    pub const fn date(length: FormatLength) -> Self {
+        Self {
+            date: Some(length),
+            time: None,
+        }
+    }
+
+    /// Creates new `FormatOptions` that only format the time.
+    #[inline]
+    #[must_use]
+    pub const fn time(length: FormatLength) -> Self {
+        Self {
+            date: None,
+            time: Some(length),
+        }
+    }
+
+    /// Creates new `FormatOptions` that format both the date and the time.
+    #[inline]
+    #[must_use]
+    pub const fn date_time(date: FormatLength, time: FormatLength) -> Self {
+        Self {
+            date: Some(date),
+            time: Some(time),
+        }
+    }
+
+    fn as_length_bag(self) -> TemporalResult<Bag> {
+        match (self.date, self.time) {
+            (Some(date), Some(time)) => Ok(Bag::from_date_time_style(
+                date.as_date_length(),
+                time.as_time_length(),
+            )),
+            (Some(date), None) => Ok(Bag::from_date_style(date.as_date_length())),
+            (None, Some(time)) => Ok(Bag::from_time_style(time.as_time_length())),
+            (None, None) => {
+                Err(TemporalError::r#type()
+                    .with_message("FormatOptions must format a date or a time."))
+            }
+        }
+    }
+}
+
+impl FormatLength {
+    fn as_date_length(self) -> DateLength {
+        match self {
+            Self::Full => DateLength::Full,
+            Self::Long => DateLength::Long,
+            Self::Medium => DateLength::Medium,
+            Self::Short => DateLength::Short,
+        }
+    }
+
+    fn as_time_length(self) -> TimeLength {
+        match self {
+            Self::Full => TimeLength::Full,
+            Self::Long => TimeLength::Long,
+            Self::Medium => TimeLength::Medium,
+            Self::Short => TimeLength::Short,
+        }
+    }
+}
+
+/// A locale-specific formatter for a single calendar and set of `FormatOptions`.
+///
+/// `LocaleFormatter`s are cheap to clone and share the underlying formatter.
+#[derive(Debug, Clone)]
+pub struct LocaleFormatter {
+    kind: AnyCalendarKind,
+    options: FormatOptions,
+    inner: Arc<DateTimeFormatter>,
+}
+
+// ==== Public API ====
+
+impl LocaleFormatter {
+    /// Returns a `LocaleFormatter` for the provided BCP-47 locale, options, and calendar.
+    ///
+    /// The formatter is taken from the formatter cache when one was already created for the
+    /// same locale, options, and calendar. A calendar set with the locale's `-u-ca` extension
+    /// is replaced by the provided calendar, unless the calendar is ISO 8601, in which case
+    /// the locale's calendar is used.
+    pub fn try_new<C: CalendarProtocol>(
+        locale: &str,
+        options: FormatOptions,
+        calendar: &CalendarSlot<C>,
+    ) -> TemporalResult<Self> {
+        let CalendarSlot::Builtin(calendar, _) = calendar else {
+            return Err(TemporalError::range()
+                .with_message("Only builtin calendars can be formatted with a locale."));
+        };
+        let kind = calendar.kind();
+
+        let key: FormatterKey = (formatter_locale(locale, kind)?, options);
+
+        let cache = formatter_cache();
+        if let Some(inner) = cache.get(&key) {
+            return Ok(Self {
+                kind,
+                options,
+                inner,
+            });
+        }
+
+        // NOTE: The lock is not held while the formatter is created so that other threads are
+        // not blocked on loading locale data.
+        let bag = options.as_length_bag()?;
+        let inner = DateTimeFormatter::try_new(&(&key.0).into(), bag.into())
+            .map(Arc::new)
+            .map_err(|e| TemporalError::range().with_message(e.to_string()))?;
+        Ok(Self {
+            kind,
+            options,
+            inner: cache.insert(key, inner),
+        })
+    }
+
+    /// Returns the `FormatOptions` of this formatter.
+    #[inline]
+    #[must_use]
+    pub fn options(&self) -> FormatOptions {
+        self.options
+    }
+
+    /// Formats a `Date` into `out`, appending to any existing contents.
+    pub fn format_date<C: CalendarProtocol>(
+        &self,
+        date: &Date<C>,
+        out: &mut String,
+    ) -> TemporalResult<()> {
+        self.format_iso(date.calendar(), date.iso, IsoTime::default(), out)
+    }
+
+    /// Formats a `DateTime` into `out`, appending to any existing contents.
+    pub fn format_date_time<C: CalendarProtocol>(
+        &self,
+        date_time: &DateTime<C>,
+        out: &mut String,
+    ) -> TemporalResult<()> {
+        self.format_iso(
+            date_time.calendar(),
+            date_time.iso.date,
+            date_time.iso.time,
+            out,
+        )
+    }
+
+    /// Formats a `Time` into `out`, appending to any existing contents.
+    ///
+    /// The formatter must have been created without a date length.
+    pub fn format_time(&self, time: &Time, out: &mut String) -> TemporalResult<()> {
+        if self.options.date.is_some() {
+            return Err(TemporalError::r#type()
+                .with_message("A Time cannot be formatted with a date length."));
+        }
+        let date = IsoDate::new_unchecked(1970, 1, 1).as_icu4x()?;
+        self.write(&IcuDateTime::new(date, icu_time(time.iso)?).to_any(), out)
+    }
+}
+
+// ==== Private API ====
+
+impl LocaleFormatter {
+    /// Formats an ISO date and time of a component with the provided calendar.
+    ///
+    /// Temporal only formats components whose calendar is either ISO 8601 or the formatter's
+    /// calendar.
+    fn format_iso<C: CalendarProtocol>(
+        &self,
+        calendar: &CalendarSlot<C>,
+        date: IsoDate,
+        time: IsoTime,
+        out: &mut String,
+    ) -> TemporalResult<()> {
+        let time = icu_time(time)?;
+        match calendar {
+            // NOTE: The formatter converts the ISO date into its own calendar.
+            CalendarSlot::Builtin(AnyCalendar::Iso(_), _) => {
+                self.write(&IcuDateTime::new(date.as_icu4x()?, time).to_any(), out)
+            }
+            // NOTE: A date in the formatter's calendar is built from the fields projected by the
+            // `CalendarSlot`, so the formatter does not convert it again.
+            CalendarSlot::Builtin(builtin, _) if builtin.kind() == self.kind => {
+                let date = calendar.builtin_icu4x_date(date)?;
+                self.write(&IcuDateTime::new(date, time), out)
+            }
+            _ => Err(TemporalError::range()
+                .with_message("The calendar does not match the formatter's calendar.")),
+        }
+    }
+
+    fn write<T>(&self, value: &T, out: &mut String) -> TemporalResult<()>
+    where
+        T: DateTimeInput<Calendar = AnyCalendar>,
+    {
+        let formatted = self
+            .inner
+            .format(value)
+            .map_err(|e| TemporalError::range().with_message(e.to_string()))?;
+        write!(out, "{formatted}").map_err(|e| TemporalError::general(e.to_string()))
+    }
+}
+
+/// Parses the locale of a formatter for the provided calendar.
+fn formatter_locale(locale: &str, kind: AnyCalendarKind) -> TemporalResult<Locale> {
+    let mut locale: Locale = locale
+        .parse()
+        .map_err(|_| TemporalError::range().with_message("Invalid locale identifier."))?;
+    // NOTE: There are no formatting patterns for the ISO 8601 calendar, so ISO components are
+    // formatted in the locale's calendar, which the formatter converts them into.
+    if kind != AnyCalendarKind::Iso {
+        locale
+            .extensions
+            .unicode
+            .keywords
+            .set(key!("ca"), kind.as_bcp47_value());
+    }
+    Ok(locale)
+}
+
+fn icu_time(time: IsoTime) -> TemporalResult<IcuTime> {
+    let nanosecond = u32::from(time.millisecond) * 1_000_000
+        + u32::from(time.microsecond) * 1_000
+        + u32::from(time.nanosecond);
+    IcuTime::try_new(time.hour, time.minute, time.second, nanosecond)
+        .map_err(|e| TemporalError::range().with_message(e.to_string()))
+}
+
+// ==== Formatter cache ====
+
+/// Sets the maximum number of formatters held by the formatter cache, evicting the oldest
+/// formatters if needed. A capacity of zero disables the cache.
+pub fn set_formatter_cache_capacity(capacity: usize) {
+    let mut formatters = formatter_cache().lock();
+    formatters.capacity = capacity;
+    formatters.evict();
+}
+
+/// Removes all formatters from the formatter cache.
+pub fn clear_formatter_cache() {
+    let mut formatters = formatter_cache().lock();
+    formatters.formatters.clear();
+    formatters.order.clear();
+}
+
+/// The parsed locale, including its calendar, and the options of a formatter.
+type FormatterKey = (Locale, FormatOptions);
+
+#[derive(Debug)]
+struct Formatters<T> {
+    formatters: FxHashMap<FormatterKey, Arc<T>>,
+    /// The keys of `formatters` in insertion order.
+    order: VecDeque<FormatterKey>,
+    capacity: usize,
+}
+
+impl<T> Formatters<T> {
+    fn new(capacity: usize) -> Self {
+        Self {
+            formatters: FxHashMap::default(),
+            order: VecDeque::new(),
+            capacity,
+        }
+    }
+
+    /// Inserts a formatter, returning the formatter that is cached for `key` if another
+    /// thread inserted one first.
+    fn insert(&mut self, key: FormatterKey, formatter: Arc<T>) -> Arc<T> {
+        if let Some(cached) = self.formatters.get(&key) {
+            return cached.clone();
+        }
+        if self.capacity == 0 {
+            return formatter;
+        }
+        self.order.push_back(key.clone());
+        self.formatters.insert(key, formatter.clone());
+        self.evict();
+        formatter
+    }
+
+    fn evict(&mut self) {
+        while self.order.len() > self.capacity {
+            if let Some(key) = self.order.pop_front() {
+                self.formatters.remove(&key);
+            }
+        }
+    }
+}
+
+#[derive(Debug)]
+struct FormatterCache(Mutex<Formatters<DateTimeFormatter>>);
+
+impl FormatterCache {
+    fn lock(&self) -> MutexGuard<'_, Formatters<DateTimeFormatter>> {
+        // NOTE: A panic while holding the lock cannot leave `Formatters` in an invalid state.
+        self.0.lock().unwrap_or_else(PoisonError::into_inner)
+    }
+
+    fn get(&self, key: &FormatterKey) -> Option<Arc<DateTimeFormatter>> {
+        self.lock().formatters.get(key).cloned()
+    }
+
+    fn insert(
+        &self,
+        key: FormatterKey,
+        formatter: Arc<DateTimeFormatter>,
+    ) -> Arc<DateTimeFormatter> {
+        self.lock().insert(key, formatter)
+    }
+}
+
+fn formatter_cache() -> &'static FormatterCache {
+    static CACHE: OnceLock<FormatterCache> = OnceLock::new();
+    CACHE.get_or_init(|| {
+        FormatterCache(Mutex::new(Formatters::new(
+            DEFAULT_FORMATTER_CACHE_CAPACITY,
+        )))
+    })
+}
+
+#[cfg(test)]
+mod tests {
+    use std::{str::FromStr, sync::Arc};
+
+    use icu_calendar::AnyCalendarKind;
+    use icu_locid::Locale;
+
+    use super::{formatter_locale, FormatLength, FormatOptions, Formatters, LocaleFormatter};
+    use crate::components::{calendar::CalendarSlot, Date, DateTime, Time};
+    use crate::options::ArithmeticOverflow;
+
+    #[test]
+    fn formatters_eviction() {
+        let key = |locale: &str| {
+            let locale: Locale = locale.parse().unwrap();
+            (locale, FormatOptions::date(FormatLength::Short))
+        };
+        let mut formatters = Formatters::new(2);
+        formatters.insert(key("en"), Arc::new(1));
+        formatters.insert(key("de"), Arc::new(2));
+        // A formatter inserted by another thread first is preferred.
+        assert_eq!(*formatters.insert(key("en"), Arc::new(3)), 1);
+
+        formatters.insert(key("fr"), Arc::new(4));
+        assert!(!formatters.formatters.contains_key(&key("en")));
+        assert_eq!(formatters.order.len(), 2);
+
+        formatters.capacity = 0;
+        formatters.evict();
+        assert!(formatters.formatters.is_empty());
+        assert_eq!(*formatters.insert(key("en"), Arc::new(5)), 5);
+        assert!(formatters.formatters.is_empty());
+    }
+
+    #[test]
+    fn formatter_locale_calendar() {
+        let locale = |locale: &str, kind| formatter_locale(locale, kind).unwrap().to_string();
+        // ISO components use the locale's calendar, whether or not it is explicit.
+        assert_eq!(locale("en-US", AnyCalendarKind::Iso), "en-US");
+        assert_eq!(
+            locale("th-u-ca-buddhist", AnyCalendarKind::Iso),
+            "th-u-ca-buddhist"
+        );
+        // Other calendars replace the locale's calendar.
+        assert_eq!(
+            locale("en-US", AnyCalendarKind::Gregorian),
+            "en-US-u-ca-gregory"
+        );
+        assert_eq!(
+            locale("th-u-ca-buddhist", AnyCalendarKind::Japanese),
+            "th-u-ca-japanese"
+        );
+        assert!(formatter_locale("not a locale!", AnyCalendarKind::Iso).is_err());
+    }
+
+    #[test]
+    fn format_with_cached_formatter() {
+        let iso = CalendarSlot::<()>::from_str("iso8601").unwrap();
+        let options = FormatOptions::date(FormatLength::Medium);
+        let formatter = LocaleFormatter::try_new("en-US", options, &iso).unwrap();
+        let cached = LocaleFormatter::try_new("en-US", options, &iso).unwrap();
+        assert!(Arc::ptr_eq(&formatter.inner, &cached.inner));
+
+        let date = Date::new(2024, 3, 15, iso.clone(), ArithmeticOverflow::Reject).unwrap();
+        let mut out = String::new();
+        formatter.format_date(&date, &mut out).unwrap();
+        assert_eq!(out, "Mar 15, 2024");
+
+        // The buffer is reused across calls.
+        out.clear();
+        let date_time = DateTime::new(2024, 3, 15, 13, 5, 0, 0, 0, 0, iso.clone()).unwrap();
+        let formatter = LocaleFormatter::try_new(
+            "en-US",
+            FormatOptions::date_time(FormatLength::Short, FormatLength::Short),
+            &iso,
+        )
+        .unwrap();
+        formatter.format_date_time(&date_time, &mut out).unwrap();
+        assert!(out.starts_with("3/15/24"));
+
+        let time = Time::new(13, 5, 0, 0, 0, 0, ArithmeticOverflow::Reject).unwrap();
+        assert!(formatter.format_time(&time, &mut out).is_err());
+
+        assert!(LocaleFormatter::try_new("en-US", FormatOptions::default(), &iso).is_err());
+    }
+
+    #[test]
+    fn format_with_builtin_calendar() {
+        let gregory = CalendarSlot::<()>::from_str("gregory").unwrap();
+        let options = FormatOptions::date(FormatLength::Medium);
+        let formatter = LocaleFormatter::try_new("en-US", options, &gregory).unwrap();
+        // Locales are cached by their parsed value rather than their source string.
+        let cached = LocaleFormatter::try_new("EN-us", options, &gregory).unwrap();
+        assert!(Arc::ptr_eq(&formatter.inner, &cached.inner));
+
+        let mut out = String::new();
+        let date = Date::new(2024, 3, 15, gregory, ArithmeticOverflow::Reject).unwrap();
+        formatter.format_date(&date, &mut out).unwrap();
+        assert_eq!(out, "Mar 15, 2024");
+
+        // A component in another calendar cannot be formatted.
+        let buddhist = CalendarSlot::<()>::from_str("buddhist").unwrap();
+        let date = Date::new(2024, 3, 15, buddhist, ArithmeticOverflow::Reject).unwrap();
+        assert!(formatter.format_date(&date, &mut out).is_err());
+    }
+}
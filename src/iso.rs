@@ -21,13 +21,17 @@ use crate::{
         Date, Duration,
     },
     error::TemporalError,
+    fields::TimeFields,
     options::{ArithmeticOverflow, RoundingIncrement, TemporalRoundingMode, TemporalUnit},
     rounding::{IncrementRounder, Round},
     utils, TemporalResult, TemporalUnwrap, NS_PER_DAY,
 };
 use icu_calendar::{Date as IcuDate, Iso};
 use num_bigint::BigInt;
-use num_traits::{cast::FromPrimitive, ToPrimitive};
+use num_traits::ToPrimitive;
+
+#[cfg(test)]
+mod reference;
 
 /// `IsoDateTime` is the record of the `IsoDate` and `IsoTime` internal slots.
 #[non_exhaustive]
@@ -39,10 +43,21 @@ pub struct IsoDateTime {
 
 impl IsoDateTime {
     /// Creates a new `IsoDateTime` without any validaiton.
-    pub(crate) fn new_unchecked(date: IsoDate, time: IsoTime) -> Self {
+    pub(crate) const fn new_unchecked(date: IsoDate, time: IsoTime) -> Self {
         Self { date, time }
     }
 
+    /// Creates a new validated `IsoDateTime` in a const context, returning `None` if the date
+    /// or time is not valid or the `IsoDateTime` is not within valid limits.
+    #[inline]
+    #[must_use]
+    pub const fn try_new(date: IsoDate, time: IsoTime) -> Option<Self> {
+        if !date.is_valid() || !time.is_valid() || !iso_dt_within_valid_limits(date, &time) {
+            return None;
+        }
+        Some(Self::new_unchecked(date, time))
+    }
+
     /// Creates a new validated `IsoDateTime` that is within valid limits.
     pub(crate) fn new(date: IsoDate, time: IsoTime) -> TemporalResult<Self> {
         if !iso_dt_within_valid_limits(date, &time) {
@@ -53,76 +68,69 @@ impl IsoDateTime {
         Ok(Self::new_unchecked(date, time))
     }
 
-    // NOTE: The below assumes that nanos is from an `Instant` and thus in a valid range. -> Needs validation.
-    /// Creates an `IsoDateTime` from a `BigInt` of epochNanoseconds.
+    /// Creates an `IsoDateTime` from a `BigInt` of epochNanoseconds and an offset in
+    /// nanoseconds.
+    ///
+    /// NOTE: `nanos` must be from an `Instant` and `offset` must be less than a day, which
+    /// keeps the result within the valid `IsoDateTime` limits.
     pub(crate) fn from_epoch_nanos(nanos: &BigInt, offset: f64) -> TemporalResult<Self> {
-        // Skip the assert as nanos should be validated by Instant.
-        // TODO: Determine whether value needs to be validated as integral.
-        // Get the component ISO parts
-        let mathematical_nanos = nanos.to_f64().ok_or_else(|| {
+        // NOTE: The epoch nanoseconds are balanced with integer arithmetic, as an `f64` cannot
+        // represent every epoch nanosecond value exactly.
+        let nanos = nanos.to_i128().ok_or_else(|| {
             TemporalError::range().with_message("nanos was not within a valid range.")
         })?;
+        Ok(Self::from_nanoseconds(nanos + offset as i128))
+    }
 
-        // 2. Let remainderNs be epochNanoseconds modulo 10^6.
-        let remainder_nanos = mathematical_nanos % 1_000_000f64;
-
-        // 3. Let epochMilliseconds be 𝔽((epochNanoseconds - remainderNs) / 10^6).
-        let epoch_millis = ((mathematical_nanos - remainder_nanos) / 1_000_000f64).floor();
-
-        let year = utils::epoch_time_to_epoch_year(epoch_millis);
-        let month = utils::epoch_time_to_month_in_year(epoch_millis) + 1;
-        let day = utils::epoch_time_to_date(epoch_millis);
-
-        // 7. Let hour be ℝ(! HourFromTime(epochMilliseconds)).
-        let hour = (epoch_millis / 3_600_000f64).floor() % 24f64;
-        // 8. Let minute be ℝ(! MinFromTime(epochMilliseconds)).
-        let minute = (epoch_millis / 60_000f64).floor() % 60f64;
-        // 9. Let second be ℝ(! SecFromTime(epochMilliseconds)).
-        let second = (epoch_millis / 1000f64).floor() % 60f64;
-        // 10. Let millisecond be ℝ(! msFromTime(epochMilliseconds)).
-        let millis = (epoch_millis % 1000f64).floor() % 1000f64;
-
-        // 11. Let microsecond be floor(remainderNs / 1000).
-        let micros = (remainder_nanos / 1000f64).floor();
-        // 12. Assert: microsecond < 1000.
-        debug_assert!(micros < 1000f64);
-        // 13. Let nanosecond be remainderNs modulo 1000.
-        let nanos = (remainder_nanos % 1000f64).floor();
+    /// Returns whether the `IsoDateTime` is within valid limits.
+    pub(crate) fn is_within_limits(&self) -> bool {
+        iso_dt_within_valid_limits(self.date, &self.time)
+    }
 
-        Ok(Self::balance(
-            year,
-            i32::from(month),
-            i32::from(day),
-            hour,
-            minute,
-            second,
-            millis,
-            micros,
-            nanos + offset,
-        ))
+    /// Returns the epoch nanoseconds of this `IsoDateTime` when interpreted as UTC.
+    #[inline]
+    pub(crate) const fn as_nanoseconds(&self) -> i128 {
+        let days =
+            utils::epoch_days_from_gregorian_date(self.date.year, self.date.month, self.date.day);
+        days as i128 * NS_PER_DAY as i128 + self.time.as_nanoseconds()
     }
 
-    #[allow(clippy::too_many_arguments)]
-    fn balance(
-        year: i32,
-        month: i32,
-        day: i32,
-        hour: f64,
-        minute: f64,
-        second: f64,
-        millisecond: f64,
-        microsecond: f64,
-        nanosecond: f64,
-    ) -> Self {
-        let (overflow_day, time) =
-            IsoTime::balance(hour, minute, second, millisecond, microsecond, nanosecond);
-        let date = IsoDate::balance(year, month, day + overflow_day);
-        Self::new_unchecked(date, time)
+    /// Creates an `IsoDateTime` from nanoseconds since the epoch interpreted as UTC. This is
+    /// the inverse of `as_nanoseconds`.
+    #[inline]
+    pub(crate) fn from_nanoseconds(nanos: i128) -> Self {
+        let ns_per_day = i128::from(NS_PER_DAY);
+        let days = nanos.div_euclid(ns_per_day);
+        let time = nanos.rem_euclid(ns_per_day);
+        // NOTE: `days` is well within an i64 range for `nanos` within the valid
+        // `IsoDateTime` limits, which callers must uphold.
+        let (year, month, day) = utils::gregorian_date_from_epoch_days(days as i64);
+        let time = IsoTime::new_unchecked(
+            (time / 3_600_000_000_000) as u8,
+            (time / 60_000_000_000 % 60) as u8,
+            (time / 1_000_000_000 % 60) as u8,
+            (time / 1_000_000 % 1000) as u16,
+            (time / 1_000 % 1000) as u16,
+            (time % 1000) as u16,
+        );
+        Self::new_unchecked(IsoDate::new_unchecked(year, month, day), time)
     }
 
-    /// Returns whether the `IsoDateTime` is within valid limits.
-    pub(crate) fn is_within_limits(&self) -> bool {
-        iso_dt_within_valid_limits(self.date, &self.time)
+    /// Adds exact nanoseconds to this `IsoDateTime`.
+    ///
+    /// The addition is done on the epoch nanoseconds with integer arithmetic, so no calendar
+    /// or balancing is involved.
+    pub(crate) fn add_nanoseconds(&self, nanos: i128) -> TemporalResult<Self> {
+        let result = self
+            .as_nanoseconds()
+            .checked_add(nanos)
+            .unwrap_or(i128::MAX);
+        if !nanoseconds_within_valid_limits(result) {
+            return Err(
+                TemporalError::range().with_message("IsoDateTime not within a valid range.")
+            );
+        }
+        Ok(Self::from_nanoseconds(result))
     }
 
     /// Specification equivalent to 5.5.9 `AddDateTime`.
@@ -181,7 +189,7 @@ pub trait IsoDateSlots {
 /// These fields are used for the `Temporal.PlainDate` object, the
 /// `Temporal.YearMonth` object, and the `Temporal.MonthDay` object.
 #[non_exhaustive]
-#[derive(Debug, Clone, Copy, Default, PartialEq, Eq, PartialOrd, Ord)]
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq, PartialOrd, Ord, Hash)]
 pub struct IsoDate {
     pub(crate) year: i32,
     pub(crate) month: u8,
@@ -194,6 +202,18 @@ impl IsoDate {
         Self { year, month, day }
     }
 
+    /// Creates a new validated `IsoDate` in a const context, returning `None` if the date is
+    /// not a valid ISO date or is not within valid limits.
+    #[inline]
+    #[must_use]
+    pub const fn try_new(year: i32, month: u8, day: u8) -> Option<Self> {
+        let date = Self::new_unchecked(year, month, day);
+        if !date.is_valid() || !iso_dt_within_valid_limits(date, &IsoTime::noon()) {
+            return None;
+        }
+        Some(date)
+    }
+
     pub(crate) fn new(
         year: i32,
         month: i32,
@@ -226,6 +246,60 @@ impl IsoDate {
         Ok(id)
     }
 
+    /// Returns this `IsoDate` with the provided fields replaced.
+    ///
+    /// The fields that are not replaced are already valid, so only the replaced fields and the
+    /// invariants that depend on them are checked again. The `month` and `day` must already be
+    /// positive, see `DateFields::validate_positive`.
+    pub(crate) fn with(
+        &self,
+        year: Option<i32>,
+        month: Option<i32>,
+        day: Option<i32>,
+        overflow: ArithmeticOverflow,
+    ) -> TemporalResult<Self> {
+        let new_year = year.unwrap_or(self.year);
+        let new_month = match (month, overflow) {
+            (None, _) => i32::from(self.month),
+            (Some(month), ArithmeticOverflow::Constrain) => month.clamp(1, 12),
+            (Some(month), ArithmeticOverflow::Reject) if (1..=12).contains(&month) => month,
+            (Some(_), ArithmeticOverflow::Reject) => {
+                return Err(TemporalError::range().with_message("not a valid ISO date."))
+            }
+        };
+
+        // NOTE: The day only needs to be checked when it, or the length of its month, changed.
+        let new_day =
+            if day.is_none() && new_year == self.year && new_month == i32::from(self.month) {
+                i32::from(self.day)
+            } else {
+                let day = day.unwrap_or(i32::from(self.day));
+                let days_in_month = utils::iso_days_in_month(new_year, new_month);
+                match overflow {
+                    ArithmeticOverflow::Constrain => day.clamp(1, days_in_month),
+                    ArithmeticOverflow::Reject if (1..=days_in_month).contains(&day) => day,
+                    ArithmeticOverflow::Reject => {
+                        return Err(TemporalError::range().with_message("not a valid ISO date."))
+                    }
+                }
+            };
+
+        // NOTE: Values have been regulated to a u8 range.
+        let date = Self::new_unchecked(new_year, new_month as u8, new_day as u8);
+
+        // NOTE: Only a date in the first or last year of the valid range can be outside of the
+        // limits.
+        if !(MIN_YEAR < new_year && new_year < MAX_YEAR)
+            && !iso_dt_within_valid_limits(date, &IsoTime::noon())
+        {
+            return Err(
+                TemporalError::range().with_message("Date is not within ISO date time limits.")
+            );
+        }
+
+        Ok(date)
+    }
+
     /// Create a balanced `IsoDate`
     ///
     /// Equivalent to `BalanceISODate`.
@@ -247,8 +321,8 @@ impl IsoDate {
     }
 
     /// Returns if the current `IsoDate` is valid.
-    pub(crate) fn is_valid(self) -> bool {
-        is_valid_date(self.year, self.month.into(), self.day.into())
+    pub(crate) const fn is_valid(self) -> bool {
+        is_valid_date(self.year, self.month as i32, self.day as i32)
     }
 
     /// Returns the resulting `IsoDate` from adding a provided `Duration` to this `IsoDate`
@@ -328,7 +402,14 @@ impl IsoDate {
         // 8. If largestUnit is "year" or largestUnit is "month", then
         if largest_unit == TemporalUnit::Year || largest_unit == TemporalUnit::Month {
             // a. Let candidateMonths be sign.
-            let mut candidate_months: i32 = sign.into();
+            // NOTE: Like the years above, the candidate months start one month short of the months
+            // between the two dates, so the below only iterates once or twice.
+            let mut candidate_months: i32 = (other.year - self.year - years) * 12
+                + i32::from(other.month)
+                - i32::from(self.month);
+            if candidate_months != 0 {
+                candidate_months -= i32::from(sign);
+            }
             // b. Let intermediate be BalanceISOYearMonth(y1 + years, m1 + candidateMonths).
             let mut intermediate =
                 balance_iso_year_month(self.year + years, i32::from(self.month) + candidate_months);
@@ -370,7 +451,7 @@ impl IsoDate {
             );
 
         let (weeks, days) = if largest_unit == TemporalUnit::Week {
-            (days / 7, days.rem_euclid(7))
+            (days / 7, days % 7)
         } else {
             (0, days)
         };
@@ -404,7 +485,7 @@ pub struct IsoTime {
 
 impl IsoTime {
     /// Creates a new `IsoTime` without any validation.
-    pub(crate) fn new_unchecked(
+    pub(crate) const fn new_unchecked(
         hour: u8,
         minute: u8,
         second: u8,
@@ -458,6 +539,56 @@ impl IsoTime {
         }
     }
 
+    /// Returns this `IsoTime` with the provided fields replaced.
+    ///
+    /// Only the replaced fields are regulated, as the other fields are already valid.
+    pub(crate) fn with(
+        &self,
+        fields: &TimeFields,
+        overflow: ArithmeticOverflow,
+    ) -> TemporalResult<Self> {
+        let with_field = |value: Option<i32>, current: u16, max: i32| match (value, overflow) {
+            (None, _) => Ok(current),
+            // NOTE: Values are clamped in a u16 range.
+            (Some(value), ArithmeticOverflow::Constrain) => Ok(value.clamp(0, max) as u16),
+            (Some(value), ArithmeticOverflow::Reject) if (0..=max).contains(&value) => {
+                Ok(value as u16)
+            }
+            (Some(_), ArithmeticOverflow::Reject) => {
+                Err(TemporalError::range().with_message("IsoTime is not valid"))
+            }
+        };
+
+        // NOTE: Hours, minutes, and seconds are within a u8 range.
+        Ok(Self::new_unchecked(
+            with_field(fields.hour, self.hour.into(), 23)? as u8,
+            with_field(fields.minute, self.minute.into(), 59)? as u8,
+            with_field(fields.second, self.second.into(), 59)? as u8,
+            with_field(fields.millisecond, self.millisecond, 999)?,
+            with_field(fields.microsecond, self.microsecond, 999)?,
+            with_field(fields.nanosecond, self.nanosecond, 999)?,
+        ))
+    }
+
+    /// Creates a new validated `IsoTime` in a const context, returning `None` if the time is
+    /// not valid.
+    #[inline]
+    #[must_use]
+    pub const fn try_new(
+        hour: u8,
+        minute: u8,
+        second: u8,
+        millisecond: u16,
+        microsecond: u16,
+        nanosecond: u16,
+    ) -> Option<Self> {
+        let time = Self::new_unchecked(hour, minute, second, millisecond, microsecond, nanosecond);
+        if !time.is_valid() {
+            return None;
+        }
+        Some(time)
+    }
+
     /// Returns an `IsoTime` set to 12:00:00
     pub(crate) const fn noon() -> Self {
         Self {
@@ -492,6 +623,28 @@ impl IsoTime {
         )
     }
 
+    /// Returns an `IsoTime` from the components of a parsed time record.
+    ///
+    /// A leap second, i.e. a second value of 60, is constrained to 59.
+    pub(crate) fn from_time_record(
+        hour: u8,
+        minute: u8,
+        second: u8,
+        nanosecond: u32,
+    ) -> TemporalResult<Self> {
+        if hour > 23 || minute > 59 || second > 60 || nanosecond > 999_999_999 {
+            return Err(TemporalError::range().with_message("IsoTime is not valid"));
+        }
+        Ok(Self::new_unchecked(
+            hour,
+            minute,
+            second.min(59),
+            (nanosecond / 1_000_000) as u16,
+            (nanosecond / 1_000 % 1_000) as u16,
+            (nanosecond % 1_000) as u16,
+        ))
+    }
+
     // NOTE(nekevss): f64 is needed here as values could exceed i32 when input.
     /// Balances and creates a new `IsoTime` with `day` overflow from the provided values.
     pub(crate) fn balance(
@@ -698,20 +851,15 @@ impl IsoTime {
     }
 
     /// Checks if the time is a valid `IsoTime`
-    pub(crate) fn is_valid(&self) -> bool {
-        if !(0..=23).contains(&self.hour) {
-            return false;
-        }
-
-        let min_sec = 0..=59;
-        if !min_sec.contains(&self.minute) || !min_sec.contains(&self.second) {
-            return false;
-        }
-
-        let sub_second = 0..=999;
-        sub_second.contains(&self.millisecond)
-            && sub_second.contains(&self.microsecond)
-            && sub_second.contains(&self.nanosecond)
+    pub(crate) const fn is_valid(&self) -> bool {
+        is_valid_time(
+            self.hour as i32,
+            self.minute as i32,
+            self.second as i32,
+            self.millisecond as i32,
+            self.microsecond as i32,
+            self.nanosecond as i32,
+        )
     }
 
     pub(crate) fn add(&self, norm: NormalizedTimeDuration) -> (i32, Self) {
@@ -730,51 +878,48 @@ impl IsoTime {
         )
     }
 
-    /// `IsoTimeToEpochMs`
-    ///
-    /// Note: This method is library specific and not in spec
-    ///
-    /// Functionally the same as Date's `MakeTime`
-    pub(crate) fn to_epoch_ms(self) -> f64 {
-        ((f64::from(self.hour) * utils::MS_PER_HOUR
-            + f64::from(self.minute) * utils::MS_PER_MINUTE)
-            + f64::from(self.second) * 1000f64)
-            + f64::from(self.millisecond)
+    /// Returns the nanoseconds since the start of the day for this `IsoTime`.
+    #[inline]
+    pub(crate) const fn as_nanoseconds(&self) -> i128 {
+        self.hour as i128 * 3_600_000_000_000
+            + self.minute as i128 * 60_000_000_000
+            + self.second as i128 * 1_000_000_000
+            + self.millisecond as i128 * 1_000_000
+            + self.microsecond as i128 * 1_000
+            + self.nanosecond as i128
     }
 }
 
 // ==== `IsoDateTime` specific utility functions ====
 
+/// The first epoch day that contains a valid `IsoDateTime`. Only times after midnight are valid.
+const MIN_EPOCH_DAYS: i64 = -100_000_001;
+/// The last epoch day that contains a valid `IsoDateTime`.
+const MAX_EPOCH_DAYS: i64 = 100_000_000;
+/// The year of `MIN_EPOCH_DAYS`.
+const MIN_YEAR: i32 = -271_821;
+/// The year of `MAX_EPOCH_DAYS`.
+const MAX_YEAR: i32 = 275_760;
+
 #[inline]
 /// Utility function to determine if a `DateTime`'s components create a `DateTime` within valid limits
-fn iso_dt_within_valid_limits(date: IsoDate, time: &IsoTime) -> bool {
-    if iso_date_to_epoch_days(date.year, (date.month - 1).into(), date.day.into()).abs()
-        > 100_000_001
-    {
-        return false;
+const fn iso_dt_within_valid_limits(date: IsoDate, time: &IsoTime) -> bool {
+    // NOTE: The valid limits are one day beyond the `Instant` limits, exclusive. As the
+    // `Instant` limits fall on midnight, only the epoch day and whether the time is midnight
+    // need to be checked.
+    match utils::epoch_days_from_gregorian_date(date.year, date.month, date.day) {
+        MIN_EPOCH_DAYS => time.as_nanoseconds() != 0,
+        epoch_days => MIN_EPOCH_DAYS <= epoch_days && epoch_days <= MAX_EPOCH_DAYS,
     }
-    let Some(ns) = utc_epoch_nanos(date, time, 0.0) else {
-        return false;
-    };
-
-    let max = BigInt::from(crate::NS_MAX_INSTANT + i128::from(NS_PER_DAY));
-    let min = BigInt::from(crate::NS_MIN_INSTANT - i128::from(NS_PER_DAY));
-
-    min < ns && max > ns
 }
 
+/// Utility function to determine if the epoch nanoseconds of an `IsoDateTime` interpreted as
+/// UTC are within valid limits.
 #[inline]
-/// Utility function to convert a `IsoDate` and `IsoTime` values into epoch nanoseconds
-fn utc_epoch_nanos(date: IsoDate, time: &IsoTime, offset: f64) -> Option<BigInt> {
-    let ms = time.to_epoch_ms();
-    let epoch_ms = utils::epoch_days_to_epoch_ms(date.to_epoch_days(), ms);
-
-    let epoch_nanos = epoch_ms.mul_add(
-        1_000_000f64,
-        f64::from(time.microsecond).mul_add(1_000f64, f64::from(time.nanosecond)),
-    );
-
-    BigInt::from_f64(epoch_nanos - offset)
+const fn nanoseconds_within_valid_limits(nanos: i128) -> bool {
+    const NS_PER_DAY_128BIT: i128 = NS_PER_DAY as i128;
+    crate::NS_MIN_INSTANT - NS_PER_DAY_128BIT < nanos
+        && nanos < crate::NS_MAX_INSTANT + NS_PER_DAY_128BIT
 }
 
 // ==== `IsoDate` specific utiltiy functions ====
@@ -798,13 +943,13 @@ fn iso_date_to_epoch_days(year: i32, month: i32, day: i32) -> i32 {
 
 #[inline]
 // Determines if the month and day are valid for the given year.
-fn is_valid_date(year: i32, month: i32, day: i32) -> bool {
-    if !(1..=12).contains(&month) {
+const fn is_valid_date(year: i32, month: i32, day: i32) -> bool {
+    if month < 1 || month > 12 {
         return false;
     }
 
-    let days_in_month = utils::iso_days_in_month(year, month);
-    (1..=days_in_month).contains(&day)
+    let days_in_month = utils::gregorian_days_in_month(year, month as u8) as i32;
+    1 <= day && day <= days_in_month
 }
 
 #[inline]
@@ -827,18 +972,16 @@ fn balance_iso_year_month(year: i32, month: i32) -> (i32, i32) {
 // ==== `IsoTime` specific utilities ====
 
 #[inline]
-fn is_valid_time(hour: i32, minute: i32, second: i32, ms: i32, mis: i32, ns: i32) -> bool {
-    if !(0..=23).contains(&hour) {
+const fn is_valid_time(hour: i32, minute: i32, second: i32, ms: i32, mis: i32, ns: i32) -> bool {
+    if hour < 0 || hour > 23 {
         return false;
     }
 
-    let min_sec = 0..=59;
-    if !min_sec.contains(&minute) || !min_sec.contains(&second) {
+    if minute < 0 || minute > 59 || second < 0 || second > 59 {
         return false;
     }
 
-    let sub_second = 0..=999;
-    sub_second.contains(&ms) && sub_second.contains(&mis) && sub_second.contains(&ns)
+    0 <= ms && ms <= 999 && 0 <= mis && mis <= 999 && 0 <= ns && ns <= 999
 }
 
 // NOTE(nekevss): Considering the below: Balance can probably be altered from f64.
@@ -0,0 +1,464 @@
+//! This module implements a differential testing harness for the ISO 8601 date and time
+//! equations.
+//!
+//! Each optimized path is run over randomized inputs from the full range of valid
+//! `IsoDateTime`s along with a reference model that only uses simple, exact integer arithmetic.
+//! Any mismatch fails the test with the first few mismatched inputs, and the throughput of
+//! both the optimized path and the reference model is printed, e.g. with
+//! `cargo test --release iso::reference -- --nocapture`.
+//!
+//! The number of samples per path and the seed of the inputs can be set with the
+//! `TEMPORAL_DIFFERENTIAL_SAMPLES` and `TEMPORAL_DIFFERENTIAL_SEED` environment variables.
+
+use std::{fmt::Debug, time::Instant};
+
+use num_bigint::BigInt;
+
+use crate::{options::TemporalUnit, utils, NS_PER_DAY};
+
+use super::{
+    iso_date_to_epoch_days, IsoDate, IsoDateTime, IsoTime, MAX_EPOCH_DAYS, MIN_EPOCH_DAYS,
+};
+
+const DEFAULT_SAMPLES: usize = 100_000;
+const DEFAULT_SEED: u64 = 0x9E37_79B9_7F4A_7C15;
+/// The number of mismatched inputs that are reported for a path.
+const REPORTED_MISMATCHES: usize = 8;
+
+type Date = (i64, i64, i64);
+type Time = [i64; 6];
+
+// ==== Reference model ====
+
+/// An exact model of the ISO 8601 calendar that counts days with simple integer arithmetic.
+mod model {
+    use num_bigint::BigInt;
+    use num_traits::ToPrimitive;
+
+    use crate::{options::TemporalUnit, NS_PER_DAY};
+
+    use super::{Date, Time};
+
+    pub(super) fn is_leap_year(year: i64) -> bool {
+        year % 4 == 0 && (year % 100 != 0 || year % 400 == 0)
+    }
+
+    pub(super) fn days_in_month(year: i64, month: i64) -> i64 {
+        match month {
+            2 if is_leap_year(year) => 29,
+            2 => 28,
+            4 | 6 | 9 | 11 => 30,
+            _ => 31,
+        }
+    }
+
+    /// Returns the number of leap years from year zero up to, but excluding, `year`.
+    fn leap_years_before(year: i64) -> i64 {
+        let year = year - 1;
+        year.div_euclid(4) - year.div_euclid(100) + year.div_euclid(400)
+    }
+
+    pub(super) fn epoch_days((year, month, day): Date) -> i64 {
+        let year_days = 365 * (year - 1970) + leap_years_before(year) - leap_years_before(1970);
+        let month_days: i64 = (1..month).map(|month| days_in_month(year, month)).sum();
+        year_days + month_days + day - 1
+    }
+
+    pub(super) fn date_from_epoch_days(days: i64) -> Date {
+        // Estimate the year, then walk to the year that contains `days`.
+        let mut year = 1970 + (days * 400).div_euclid(146_097);
+        while epoch_days((year, 1, 1)) > days {
+            year -= 1;
+        }
+        while epoch_days((year + 1, 1, 1)) <= days {
+            year += 1;
+        }
+        let mut month = 1;
+        let mut day = days - epoch_days((year, 1, 1)) + 1;
+        while day > days_in_month(year, month) {
+            day -= days_in_month(year, month);
+            month += 1;
+        }
+        (year, month, day)
+    }
+
+    /// Returns the years, months, weeks, and days from `one` to `two`.
+    pub(super) fn diff_date(one: Date, two: Date, largest_unit: TemporalUnit) -> [i64; 4] {
+        let sign = match two.cmp(&one) {
+            std::cmp::Ordering::Less => -1,
+            std::cmp::Ordering::Equal => return [0; 4],
+            std::cmp::Ordering::Greater => 1,
+        };
+        let add_months = |months: i64| {
+            let months = one.0 * 12 + one.1 - 1 + months;
+            (months.div_euclid(12), months.rem_euclid(12) + 1)
+        };
+
+        // The most months that can be added to `one` without passing `two`.
+        let mut months = 0;
+        if matches!(largest_unit, TemporalUnit::Year | TemporalUnit::Month) {
+            months = two.0 * 12 + two.1 - (one.0 * 12 + one.1);
+            let (year, month) = add_months(months);
+            if (year, month, one.2).cmp(&two) as i64 == sign {
+                months -= sign;
+            }
+        }
+        let years = if largest_unit == TemporalUnit::Year {
+            months / 12
+        } else {
+            0
+        };
+
+        let (year, month) = add_months(months);
+        let constrained = (year, month, one.2.min(days_in_month(year, month)));
+        let days = epoch_days(two) - epoch_days(constrained);
+        let (weeks, days) = if largest_unit == TemporalUnit::Week {
+            (days / 7, days % 7)
+        } else {
+            (0, days)
+        };
+        [years, months - years * 12, weeks, days]
+    }
+
+    /// Returns the days and the time of day of `nanoseconds`.
+    fn balance_nanoseconds(nanoseconds: &BigInt) -> (i64, Time) {
+        let ns_per_day = BigInt::from(NS_PER_DAY);
+        let mut days = nanoseconds / &ns_per_day;
+        let mut time = nanoseconds % &ns_per_day;
+        if time < BigInt::from(0) {
+            days -= BigInt::from(1);
+            time += &ns_per_day;
+        }
+        let days = days.to_i64().expect("days are within an i64 range");
+        let time = time.to_i64().expect("time is less than a day");
+        (
+            days,
+            [
+                time / 3_600_000_000_000,
+                time / 60_000_000_000 % 60,
+                time / 1_000_000_000 % 60,
+                time / 1_000_000 % 1000,
+                time / 1000 % 1000,
+                time % 1000,
+            ],
+        )
+    }
+
+    pub(super) fn balance_time(
+        [hour, minute, second, millisecond, microsecond, nanosecond]: Time,
+    ) -> (i64, Time) {
+        let units = [
+            (hour, 0),
+            (minute, 60),
+            (second, 60),
+            (millisecond, 1000),
+            (microsecond, 1000),
+            (nanosecond, 1000),
+        ];
+        let nanoseconds = units.iter().fold(BigInt::from(0), |total, (value, scale)| {
+            total * BigInt::from(*scale) + BigInt::from(*value)
+        });
+        balance_nanoseconds(&nanoseconds)
+    }
+
+    pub(super) fn date_time_from_epoch_nanoseconds(
+        nanoseconds: &BigInt,
+        offset: i64,
+    ) -> (Date, Time) {
+        let (days, time) = balance_nanoseconds(&(nanoseconds + BigInt::from(offset)));
+        (date_from_epoch_days(days), time)
+    }
+}
+
+// ==== Harness ====
+
+/// A xorshift generator of the randomized inputs.
+struct Inputs(u64);
+
+impl Inputs {
+    fn new() -> Self {
+        Self(env_or("TEMPORAL_DIFFERENTIAL_SEED", DEFAULT_SEED).max(1))
+    }
+
+    fn next(&mut self) -> u64 {
+        self.0 ^= self.0 << 13;
+        self.0 ^= self.0 >> 7;
+        self.0 ^= self.0 << 17;
+        self.0
+    }
+
+    /// Returns a value in `min..=max`.
+    fn range(&mut self, min: i64, max: i64) -> i64 {
+        let span = max.abs_diff(min) + 1;
+        min.wrapping_add_unsigned(self.next() % span)
+    }
+
+    /// Returns an epoch day whose noon is within the valid `IsoDateTime` limits.
+    fn epoch_days(&mut self) -> i64 {
+        self.range(MIN_EPOCH_DAYS, MAX_EPOCH_DAYS)
+    }
+
+    fn date(&mut self) -> Date {
+        model::date_from_epoch_days(self.epoch_days())
+    }
+}
+
+fn env_or<T: std::str::FromStr>(name: &str, default: T) -> T {
+    std::env::var(name)
+        .ok()
+        .and_then(|value| value.parse().ok())
+        .unwrap_or(default)
+}
+
+fn samples() -> usize {
+    env_or("TEMPORAL_DIFFERENTIAL_SAMPLES", DEFAULT_SAMPLES)
+}
+
+/// Runs `optimized` and `reference` over every input, prints the throughput of both, and
+/// panics with the mismatched inputs if their outputs differ.
+fn differential<I: Debug, O: PartialEq + Debug>(
+    path: &str,
+    inputs: &[I],
+    optimized: impl Fn(&I) -> O,
+    reference: impl Fn(&I) -> O,
+) {
+    let start = Instant::now();
+    let optimized_outputs: Vec<O> = inputs.iter().map(&optimized).collect();
+    let optimized_elapsed = start.elapsed();
+
+    let start = Instant::now();
+    let reference_outputs: Vec<O> = inputs.iter().map(&reference).collect();
+    let reference_elapsed = start.elapsed();
+
+    let throughput = |elapsed: std::time::Duration| {
+        inputs.len() as f64 / elapsed.as_secs_f64().max(f64::MIN_POSITIVE) / 1_000_000.0
+    };
+    let mismatches: Vec<_> = inputs
+        .iter()
+        .zip(optimized_outputs.iter().zip(&reference_outputs))
+        .filter(|(_, (optimized, reference))| optimized != reference)
+        .collect();
+    println!(
+        "{path}: {} inputs, {} mismatches, optimized {:.2} M/s, reference {:.2} M/s",
+        inputs.len(),
+        mismatches.len(),
+        throughput(optimized_elapsed),
+        throughput(reference_elapsed),
+    );
+    assert!(
+        mismatches.is_empty(),
+        "{path} has {} mismatches as (input, (optimized, reference)): {:#?}",
+        mismatches.len(),
+        &mismatches[..mismatches.len().min(REPORTED_MISMATCHES)]
+    );
+}
+
+fn date_of(date: IsoDate) -> Date {
+    (
+        i64::from(date.year),
+        i64::from(date.month),
+        i64::from(date.day),
+    )
+}
+
+fn time_of(time: IsoTime) -> Time {
+    [
+        i64::from(time.hour),
+        i64::from(time.minute),
+        i64::from(time.second),
+        i64::from(time.millisecond),
+        i64::from(time.microsecond),
+        i64::from(time.nanosecond),
+    ]
+}
+
+/// The epoch days of the limits, the epoch, and the days around leap days and century years.
+fn edge_epoch_days() -> Vec<i64> {
+    let mut days = vec![MIN_EPOCH_DAYS, MAX_EPOCH_DAYS, -1, 0, 1];
+    for year in [
+        -271_820, -400, -100, -1, 0, 1, 100, 1900, 2000, 2024, 275_759,
+    ] {
+        let leap_day = model::epoch_days((year, 3, 1)) - 1;
+        days.extend([leap_day - 1, leap_day, leap_day + 1]);
+    }
+    days
+}
+
+// ==== Differential tests ====
+
+#[test]
+fn gregorian_equations() {
+    let mut inputs = Inputs::new();
+    let mut days: Vec<i64> = (0..samples()).map(|_| inputs.epoch_days()).collect();
+    days.extend(edge_epoch_days());
+    let dates: Vec<Date> = days
+        .iter()
+        .map(|days| model::date_from_epoch_days(*days))
+        .collect();
+
+    differential(
+        "utils::epoch_days_from_gregorian_date",
+        &dates,
+        |(year, month, day)| {
+            utils::epoch_days_from_gregorian_date(*year as i32, *month as u8, *day as u8)
+        },
+        |date| model::epoch_days(*date),
+    );
+    differential(
+        "utils::gregorian_date_from_epoch_days",
+        &days,
+        |days| {
+            let (year, month, day) = utils::gregorian_date_from_epoch_days(*days);
+            (i64::from(year), i64::from(month), i64::from(day))
+        },
+        |days| model::date_from_epoch_days(*days),
+    );
+    differential(
+        "utils::gregorian_days_in_month",
+        &dates,
+        |(year, month, _)| i64::from(utils::gregorian_days_in_month(*year as i32, *month as u8)),
+        |(year, month, _)| model::days_in_month(*year, *month),
+    );
+    differential(
+        "utils::iso_days_in_month",
+        &dates,
+        |(year, month, _)| i64::from(utils::iso_days_in_month(*year as i32, *month as i32)),
+        |(year, month, _)| model::days_in_month(*year, *month),
+    );
+}
+
+#[test]
+fn date_balancing() {
+    let mut inputs = Inputs::new();
+    let dates: Vec<Date> = (0..samples()).map(|_| inputs.date()).collect();
+
+    differential(
+        "iso_date_to_epoch_days",
+        &dates,
+        |(year, month, day)| {
+            i64::from(iso_date_to_epoch_days(
+                *year as i32,
+                *month as i32 - 1,
+                *day as i32,
+            ))
+        },
+        |date| model::epoch_days(*date),
+    );
+
+    // The first of a month along with a day offset that stays within the limits.
+    let unbalanced: Vec<Date> = (0..samples())
+        .map(|_| {
+            let first = inputs.range(MIN_EPOCH_DAYS + 1000, MAX_EPOCH_DAYS - 1000);
+            let (year, month, _) = model::date_from_epoch_days(first);
+            (year, month, inputs.range(-900, 900))
+        })
+        .collect();
+    differential(
+        "IsoDate::balance",
+        &unbalanced,
+        |(year, month, day)| date_of(IsoDate::balance(*year as i32, *month as i32, *day as i32)),
+        |(year, month, day)| {
+            model::date_from_epoch_days(model::epoch_days((*year, *month, 1)) + day - 1)
+        },
+    );
+}
+
+#[test]
+fn date_difference() {
+    let mut inputs = Inputs::new();
+    // Half of the pairs are close together to exercise the day constraining.
+    let pairs: Vec<(Date, Date)> = (0..samples())
+        .map(|index| {
+            let one = inputs.epoch_days();
+            let two = if index % 2 == 0 {
+                inputs.epoch_days()
+            } else {
+                (one + inputs.range(-800, 800)).clamp(MIN_EPOCH_DAYS, MAX_EPOCH_DAYS)
+            };
+            (
+                model::date_from_epoch_days(one),
+                model::date_from_epoch_days(two),
+            )
+        })
+        .collect();
+
+    for largest_unit in [
+        TemporalUnit::Year,
+        TemporalUnit::Month,
+        TemporalUnit::Week,
+        TemporalUnit::Day,
+    ] {
+        differential(
+            &format!("IsoDate::diff_iso_date({largest_unit:?})"),
+            &pairs,
+            |(one, two)| {
+                let to_iso = |(year, month, day): Date| {
+                    IsoDate::new_unchecked(year as i32, month as u8, day as u8)
+                };
+                let duration = to_iso(*one)
+                    .diff_iso_date(&to_iso(*two), largest_unit)
+                    .expect("dates are within limits");
+                [
+                    duration.years,
+                    duration.months,
+                    duration.weeks,
+                    duration.days,
+                ]
+                .map(|unit| unit as i64)
+            },
+            |(one, two)| model::diff_date(*one, *two, largest_unit),
+        );
+    }
+}
+
+#[test]
+fn time_balancing() {
+    let mut inputs = Inputs::new();
+    // NOTE: Each unit is kept within an exact `f64` range and the days within an `i32` range.
+    let times: Vec<Time> = (0..samples())
+        .map(|index| {
+            let max = if index % 2 == 0 { 1_000 } else { 1_000_000_000 };
+            [0; 6].map(|_| inputs.range(-max, max))
+        })
+        .collect();
+
+    differential(
+        "IsoTime::balance",
+        &times,
+        |time| {
+            let [hour, minute, second, millisecond, microsecond, nanosecond] =
+                time.map(|unit| unit as f64);
+            let (days, time) =
+                IsoTime::balance(hour, minute, second, millisecond, microsecond, nanosecond);
+            (i64::from(days), time_of(time))
+        },
+        |time| model::balance_time(*time),
+    );
+}
+
+#[test]
+fn epoch_nanoseconds() {
+    const NS_PER_DAY_I64: i64 = NS_PER_DAY as i64;
+    let mut inputs = Inputs::new();
+    let instants: Vec<(BigInt, i64)> = (0..samples())
+        .map(|_| {
+            // NOTE: The `Instant` limits are one day within the `IsoDateTime` limits.
+            let days = inputs.range(-100_000_000, 99_999_999);
+            let nanoseconds = i128::from(days) * i128::from(NS_PER_DAY)
+                + i128::from(inputs.range(0, NS_PER_DAY_I64 - 1));
+            let offset = inputs.range(-NS_PER_DAY_I64 + 1, NS_PER_DAY_I64 - 1);
+            (BigInt::from(nanoseconds), offset)
+        })
+        .collect();
+
+    differential(
+        "IsoDateTime::from_epoch_nanos",
+        &instants,
+        |(nanoseconds, offset)| {
+            let iso = IsoDateTime::from_epoch_nanos(nanoseconds, *offset as f64)
+                .expect("nanoseconds are within limits");
+            (date_of(iso.date), time_of(iso.time))
+        },
+        |(nanoseconds, offset)| model::date_time_from_epoch_nanoseconds(nanoseconds, *offset),
+    );
+}
@@ -45,6 +45,14 @@ pub mod iso;
 pub mod options;
 pub mod parsers;
 
+#[cfg(feature = "capi")]
+pub mod capi;
+
+#[cfg(feature = "locale_formatting")]
+pub mod format;
+
+#[doc(hidden)]
+pub mod macros;
 #[doc(hidden)]
 pub(crate) mod rounding;
 #[doc(hidden)]
@@ -57,7 +65,7 @@ pub use tinystr::TinyAsciiStr;
 #[doc(inline)]
 pub use error::TemporalError;
 #[doc(inline)]
-pub use fields::TemporalFields;
+pub use fields::{DateFields, TemporalFields, TimeFields};
 
 /// The `Temporal` result type
 pub type TemporalResult<T> = Result<T, TemporalError>;
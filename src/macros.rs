@@ -0,0 +1,196 @@
+//! This module implements macros for Temporal literals that are validated at compile time.
+//!
+//! The macros evaluate their values in a const item, so an invalid literal is a compile error
+//! and a valid one requires no validation at runtime. The functions in this module are an
+//! implementation detail of the macros.
+
+use num_bigint::BigInt;
+
+use crate::{
+    components::{calendar::CalendarSlot, Date, DateTime, Instant, Time},
+    iso::{IsoDate, IsoDateTime, IsoTime},
+};
+
+/// Creates an ISO 8601 `Date<()>` from a year, month, and day that are validated at compile
+/// time, e.g. `date!(1970, 1, 1)`.
+#[macro_export]
+macro_rules! date {
+    ($year:expr, $month:expr, $day:expr $(,)?) => {{
+        const DATE: $crate::components::Date<()> = $crate::macros::date($year, $month, $day);
+        DATE
+    }};
+}
+
+/// Creates a `Time` that is validated at compile time from an hour, minute, and second, and
+/// optionally a millisecond, microsecond, and nanosecond, e.g. `time!(12, 30, 0)`.
+#[macro_export]
+macro_rules! time {
+    ($hour:expr, $minute:expr, $second:expr $(,)?) => {
+        $crate::time!($hour, $minute, $second, 0, 0, 0)
+    };
+    (
+        $hour:expr,
+        $minute:expr,
+        $second:expr,
+        $millisecond:expr,
+        $microsecond:expr,
+        $nanosecond:expr $(,)?
+    ) => {{
+        const TIME: $crate::components::Time = $crate::macros::time(
+            $hour,
+            $minute,
+            $second,
+            $millisecond,
+            $microsecond,
+            $nanosecond,
+        );
+        TIME
+    }};
+}
+
+/// Creates an ISO 8601 `DateTime<()>` that is validated at compile time from a year, month,
+/// day, hour, minute, and second, and optionally a millisecond, microsecond, and nanosecond,
+/// e.g. `datetime!(1970, 1, 1, 12, 30, 0)`.
+#[macro_export]
+macro_rules! datetime {
+    ($year:expr, $month:expr, $day:expr, $hour:expr, $minute:expr, $second:expr $(,)?) => {
+        $crate::datetime!($year, $month, $day, $hour, $minute, $second, 0, 0, 0)
+    };
+    (
+        $year:expr,
+        $month:expr,
+        $day:expr,
+        $hour:expr,
+        $minute:expr,
+        $second:expr,
+        $millisecond:expr,
+        $microsecond:expr,
+        $nanosecond:expr $(,)?
+    ) => {{
+        const DATE_TIME: $crate::components::DateTime<()> = $crate::macros::date_time(
+            $crate::macros::date($year, $month, $day),
+            $crate::macros::time(
+                $hour,
+                $minute,
+                $second,
+                $millisecond,
+                $microsecond,
+                $nanosecond,
+            ),
+        );
+        DATE_TIME
+    }};
+}
+
+/// Creates an `Instant` from epoch nanoseconds that are validated at compile time, e.g.
+/// `instant!(1_000_000_000)`.
+///
+/// NOTE: An `Instant` holds a `BigInt`, which cannot be created in a const context, so only the
+/// validation happens at compile time.
+#[macro_export]
+macro_rules! instant {
+    ($nanoseconds:expr $(,)?) => {{
+        const NANOSECONDS: i128 = $crate::macros::epoch_nanoseconds($nanoseconds);
+        $crate::macros::instant(NANOSECONDS)
+    }};
+}
+
+#[doc(hidden)]
+#[must_use]
+pub const fn date(year: i32, month: u8, day: u8) -> Date<()> {
+    match IsoDate::try_new(year, month, day) {
+        Some(iso) => Date::new_unchecked(iso, CalendarSlot::iso()),
+        None => panic!("Invalid ISO date literal."),
+    }
+}
+
+#[doc(hidden)]
+#[must_use]
+pub const fn time(
+    hour: u8,
+    minute: u8,
+    second: u8,
+    millisecond: u16,
+    microsecond: u16,
+    nanosecond: u16,
+) -> Time {
+    match Time::try_new(hour, minute, second, millisecond, microsecond, nanosecond) {
+        Some(time) => time,
+        None => panic!("Invalid time literal."),
+    }
+}
+
+#[doc(hidden)]
+#[must_use]
+pub const fn date_time(date: Date<()>, time: Time) -> DateTime<()> {
+    match IsoDateTime::try_new(date.iso, time.iso) {
+        Some(iso) => DateTime::new_unchecked(iso, CalendarSlot::iso()),
+        None => panic!("ISO date time literal is not within valid limits."),
+    }
+}
+
+#[doc(hidden)]
+#[must_use]
+pub const fn epoch_nanoseconds(nanoseconds: i128) -> i128 {
+    if nanoseconds < crate::NS_MIN_INSTANT || nanoseconds > crate::NS_MAX_INSTANT {
+        panic!("Instant literal is not within a valid epoch range.");
+    }
+    nanoseconds
+}
+
+#[doc(hidden)]
+#[must_use]
+pub fn instant(nanoseconds: i128) -> Instant {
+    Instant {
+        nanos: BigInt::from(nanoseconds),
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use crate::{
+        components::{Date, DateTime, Instant, Time},
+        iso::{IsoDate, IsoDateTime, IsoTime},
+        options::ArithmeticOverflow,
+    };
+    use num_bigint::BigInt;
+
+    const LEAP_DAY: Date<()> = date!(2024, 2, 29);
+    const NOON: Time = time!(12, 0, 0);
+    const MAX: DateTime<()> = datetime!(275_760, 9, 13, 23, 59, 59, 999, 999, 999);
+
+    #[test]
+    fn literals_match_validated_constructors() {
+        let leap_day =
+            Date::<()>::new(2024, 2, 29, Default::default(), ArithmeticOverflow::Reject).unwrap();
+        assert_eq!(LEAP_DAY.iso, leap_day.iso);
+        assert!(LEAP_DAY.calendar().is_iso());
+
+        assert_eq!(NOON.iso, IsoTime::noon());
+        assert_eq!(MAX.iso_year(), 275_760);
+        assert_eq!(MAX.nanosecond(), 999);
+
+        let epoch = instant!(0);
+        assert_eq!(epoch, Instant::new(BigInt::from(0)).unwrap());
+    }
+
+    #[test]
+    fn const_constructors() {
+        assert!(IsoDate::try_new(2023, 2, 29).is_none());
+        assert!(IsoDate::try_new(2023, 13, 1).is_none());
+        assert!(IsoDate::try_new(-271_821, 4, 19).is_some());
+        assert!(IsoDate::try_new(-271_821, 4, 18).is_none());
+        assert!(IsoTime::try_new(24, 0, 0, 0, 0, 0).is_none());
+        assert!(IsoTime::try_new(23, 59, 59, 999, 999, 1000).is_none());
+
+        let min_date = IsoDate::try_new(-271_821, 4, 19).unwrap();
+        assert!(IsoDateTime::try_new(min_date, IsoTime::default()).is_none());
+        assert!(
+            IsoDateTime::try_new(min_date, IsoTime::try_new(0, 0, 0, 0, 0, 1).unwrap()).is_some()
+        );
+
+        assert!(Date::<()>::try_new_iso(2024, 2, 29).is_some());
+        assert!(DateTime::<()>::try_new_iso(275_760, 9, 14, 0, 0, 0, 0, 0, 0).is_none());
+        assert!(Time::try_new(12, 60, 0, 0, 0, 0).is_none());
+    }
+}
@@ -24,7 +24,7 @@ pub struct RelativeTo<'a, C: CalendarProtocol, Z: TzProtocol> {
 
 /// The relevant unit that should be used for the operation that
 /// this option is provided as a value.
-#[derive(Debug, Clone, Copy, PartialEq, Eq, PartialOrd, Ord)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, PartialOrd, Ord, Hash)]
 pub enum TemporalUnit {
     /// The `Auto` unit
     Auto = 0,
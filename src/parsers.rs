@@ -3,16 +3,21 @@
 use crate::{TemporalError, TemporalResult};
 
 use ixdtf::parsers::{
-    records::{Annotation, IxdtfParseRecord},
+    records::{Annotation, IxdtfParseRecord, UTCOffsetRecord},
     IxdtfParser,
 };
 
+mod duration;
+
+pub(crate) use duration::parse_duration;
+
 // TODO: Determine if these should be separate structs, i.e. TemporalDateTimeParser/TemporalInstantParser, or
 // maybe on global `TemporalParser` around `IxdtfParser` that handles the Temporal idiosyncracies.
 enum ParseVariant {
     YearMonth,
     MonthDay,
     DateTime,
+    Time,
 }
 
 #[inline]
@@ -45,12 +50,15 @@ fn parse_ixdtf(source: &str, variant: ParseVariant) -> TemporalResult<IxdtfParse
         Some(annotation)
     });
 
+    let requires_date = !matches!(variant, ParseVariant::Time);
+
     let mut record = match variant {
         ParseVariant::YearMonth => parser.parse_year_month_with_annotation_handler(handler),
         ParseVariant::MonthDay => parser.parse_month_day_with_annotation_handler(handler),
         ParseVariant::DateTime => parser.parse_with_annotation_handler(handler),
+        ParseVariant::Time => parser.parse_time_with_annotation_handler(handler),
     }
-    .map_err(|e| TemporalError::general(format!("{e}")))?;
+    .map_err(|e| TemporalError::syntax().with_message(format!("{e}")))?;
 
     if critical_duplicate_calendar {
         // TODO: Add tests for the below.
@@ -60,7 +68,7 @@ fn parse_ixdtf(source: &str, variant: ParseVariant) -> TemporalResult<IxdtfParse
     }
 
     // Validate that the DateRecord exists.
-    if record.date.is_none() {
+    if requires_date && record.date.is_none() {
         return Err(
             TemporalError::syntax().with_message("DateTime strings must contain a Date value.")
         );
@@ -77,7 +85,6 @@ pub(crate) fn parse_date_time(source: &str) -> TemporalResult<IxdtfParseRecord>
 }
 
 /// A utility function for parsing an `Instant` string
-#[allow(unused)]
 pub(crate) fn parse_instant(source: &str) -> TemporalResult<IxdtfParseRecord> {
     let record = parse_ixdtf(source, ParseVariant::DateTime)?;
 
@@ -103,8 +110,8 @@ pub(crate) fn parse_year_month(source: &str) -> TemporalResult<IxdtfParseRecord>
 
     match dt_parse {
         Ok(dt) => Ok(dt),
-        // Format and return the error from parsing YearMonth.
-        _ => ym_record.map_err(|e| TemporalError::range().with_message(format!("{e}"))),
+        // Return the syntax error from parsing YearMonth.
+        _ => ym_record,
     }
 }
 
@@ -120,9 +127,74 @@ pub(crate) fn parse_month_day(source: &str) -> TemporalResult<IxdtfParseRecord>
 
     match dt_parse {
         Ok(dt) => Ok(dt),
-        // Format and return the error from parsing YearMonth.
-        _ => md_record.map_err(|e| TemporalError::range().with_message(format!("{e}"))),
+        // Return the syntax error from parsing MonthDay.
+        _ => md_record,
     }
 }
 
-// TODO: ParseTemporalTimeString, ParseTimeZoneString, ParseZonedDateTimeString
+/// A utility function for parsing a `ZonedDateTime` string
+pub(crate) fn parse_zoned_date_time(source: &str) -> TemporalResult<IxdtfParseRecord> {
+    let record = parse_ixdtf(source, ParseVariant::DateTime)?;
+
+    // Validate that the TimeZone annotation exists.
+    if record.tz.is_none() {
+        return Err(TemporalError::range()
+            .with_message("ZonedDateTime strings must contain a TimeZone annotation."));
+    }
+
+    Ok(record)
+}
+
+/// A utility function for parsing a `Time` string
+pub(crate) fn parse_time(source: &str) -> TemporalResult<IxdtfParseRecord> {
+    let time_record = parse_ixdtf(source, ParseVariant::Time);
+
+    let record = match time_record {
+        Ok(time) => time,
+        Err(e) => match parse_ixdtf(source, ParseVariant::DateTime) {
+            Ok(dt) => dt,
+            // Return the syntax error from parsing Time.
+            _ => return Err(e),
+        },
+    };
+
+    // Validate that the TimeRecord exists.
+    if record.time.is_none() {
+        return Err(TemporalError::range().with_message("Time strings must contain a Time value."));
+    }
+
+    // A time with a UTC designator is an exact time rather than a wall-clock time.
+    if has_utc_designator(&record, source) {
+        return Err(
+            TemporalError::range().with_message("Time strings must not contain a UTC designator.")
+        );
+    }
+
+    Ok(record)
+}
+
+/// Returns whether the parsed UTC offset of `record` is the `Z` UTC designator.
+// NOTE: ixdtf 0.2 records a `Z` designator as a zero `UTCOffsetRecord`, the same as a `+00:00`
+// offset. So only a parsed zero offset is told apart by the last character of the date time,
+// which the annotations are the only part to follow.
+#[inline]
+pub(crate) fn has_utc_designator(record: &IxdtfParseRecord, source: &str) -> bool {
+    let Some(offset) = record.offset.as_ref() else {
+        return false;
+    };
+    if utc_offset_nanoseconds(offset) != 0 {
+        return false;
+    }
+    let date_time = source.split('[').next().unwrap_or(source);
+    date_time.ends_with(['Z', 'z'])
+}
+
+/// Returns the signed nanoseconds for a parsed UTC offset.
+#[inline]
+pub(crate) fn utc_offset_nanoseconds(offset: &UTCOffsetRecord) -> i128 {
+    let nanoseconds = i128::from(offset.hour) * 3_600_000_000_000
+        + i128::from(offset.minute) * 60_000_000_000
+        + i128::from(offset.second) * 1_000_000_000
+        + i128::from(offset.nanosecond);
+    i128::from(offset.sign as i8) * nanoseconds
+}
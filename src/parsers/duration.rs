@@ -0,0 +1,208 @@
+//! This module implements an exact parser for ISO 8601 duration strings.
+//!
+//! The parser works directly on the bytes of the source string without allocating, and
+//! fractional hours, minutes, and seconds are accumulated into integer nanoseconds, so no
+//! precision is lost to floating point arithmetic.
+
+use crate::{TemporalError, TemporalResult};
+
+/// The largest integer that can be exactly represented by the `f64` fields of a `Duration`.
+const MAX_SAFE_INTEGER: u64 = (1 << 53) - 1;
+
+const NANOSECONDS_PER_SECOND: u64 = 1_000_000_000;
+const NANOSECONDS_PER_MINUTE: u64 = 60 * NANOSECONDS_PER_SECOND;
+
+/// The absolute values of the fields of a parsed ISO 8601 duration string along with its sign.
+#[derive(Debug, Default, Clone, Copy, PartialEq, Eq)]
+pub(crate) struct DurationRecord {
+    pub(crate) negative: bool,
+    pub(crate) years: u64,
+    pub(crate) months: u64,
+    pub(crate) weeks: u64,
+    pub(crate) days: u64,
+    pub(crate) hours: u64,
+    pub(crate) minutes: u64,
+    pub(crate) seconds: u64,
+    pub(crate) milliseconds: u64,
+    pub(crate) microseconds: u64,
+    pub(crate) nanoseconds: u64,
+}
+
+/// The units of a duration string in the order that they must appear.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, PartialOrd, Ord)]
+enum Unit {
+    Year,
+    Month,
+    Week,
+    Day,
+    Hour,
+    Minute,
+    Second,
+}
+
+/// Parses an ISO 8601 duration string, i.e. `-P1Y2M3W4DT5H6M7.123456789S`.
+///
+/// Only the last time unit may have a fraction of up to nine digits, which is converted into
+/// the smaller units of the duration exactly.
+pub(crate) fn parse_duration(source: &str) -> TemporalResult<DurationRecord> {
+    let mut bytes = source.as_bytes();
+    let mut record = DurationRecord::default();
+
+    // Sign? DurationDesignator
+    if let Some(rest) = bytes.strip_prefix("\u{2212}".as_bytes()) {
+        record.negative = true;
+        bytes = rest;
+    } else if let Some((sign @ (b'+' | b'-'), rest)) = bytes.split_first() {
+        record.negative = *sign == b'-';
+        bytes = rest;
+    }
+    bytes = match bytes.split_first() {
+        Some((b'P' | b'p', rest)) => rest,
+        _ => {
+            return Err(syntax_error(
+                "Duration strings must begin with a duration designator.",
+            ))
+        }
+    };
+
+    let mut in_time = false;
+    let mut last_unit = None;
+    let mut has_fraction = false;
+    while let Some(&next) = bytes.first() {
+        if matches!(next, b'T' | b't') {
+            if in_time {
+                return Err(syntax_error(
+                    "Duplicate time designator in duration string.",
+                ));
+            }
+            in_time = true;
+            bytes = &bytes[1..];
+            if bytes.is_empty() {
+                return Err(syntax_error(
+                    "A time designator must be followed by a time unit.",
+                ));
+            }
+            continue;
+        }
+
+        // NOTE: A fraction is only valid on the last unit of the duration string.
+        if has_fraction {
+            return Err(syntax_error(
+                "Only the last unit of a duration may have a fraction.",
+            ));
+        }
+
+        let (value, rest) = parse_integer(bytes)?;
+        let (fraction, rest) = parse_fraction(rest)?;
+        let (unit, rest) = match (rest.split_first(), in_time) {
+            (Some((b'Y' | b'y', rest)), false) => (Unit::Year, rest),
+            (Some((b'M' | b'm', rest)), false) => (Unit::Month, rest),
+            (Some((b'W' | b'w', rest)), false) => (Unit::Week, rest),
+            (Some((b'D' | b'd', rest)), false) => (Unit::Day, rest),
+            (Some((b'H' | b'h', rest)), true) => (Unit::Hour, rest),
+            (Some((b'M' | b'm', rest)), true) => (Unit::Minute, rest),
+            (Some((b'S' | b's', rest)), true) => (Unit::Second, rest),
+            _ => return Err(syntax_error("Invalid or missing duration unit designator.")),
+        };
+        bytes = rest;
+
+        if last_unit.is_some_and(|last| last >= unit) {
+            return Err(syntax_error(
+                "Duration units must be unique and in descending order.",
+            ));
+        }
+        last_unit = Some(unit);
+
+        match unit {
+            Unit::Year => record.years = value,
+            Unit::Month => record.months = value,
+            Unit::Week => record.weeks = value,
+            Unit::Day => record.days = value,
+            Unit::Hour => record.hours = value,
+            Unit::Minute => record.minutes = value,
+            Unit::Second => record.seconds = value,
+        }
+
+        if let Some(fraction) = fraction {
+            if !in_time {
+                return Err(syntax_error(
+                    "Only time units of a duration may have a fraction.",
+                ));
+            }
+            has_fraction = true;
+            // NOTE: `fraction` is the fraction of the unit in billionths, so multiplying it by
+            // the length of the unit in seconds yields exact nanoseconds.
+            let nanoseconds = match unit {
+                Unit::Hour => {
+                    let nanoseconds = fraction * 3600;
+                    record.minutes = nanoseconds / NANOSECONDS_PER_MINUTE;
+                    record.seconds = nanoseconds % NANOSECONDS_PER_MINUTE / NANOSECONDS_PER_SECOND;
+                    nanoseconds % NANOSECONDS_PER_SECOND
+                }
+                Unit::Minute => {
+                    let nanoseconds = fraction * 60;
+                    record.seconds = nanoseconds / NANOSECONDS_PER_SECOND;
+                    nanoseconds % NANOSECONDS_PER_SECOND
+                }
+                _ => fraction,
+            };
+            record.milliseconds = nanoseconds / 1_000_000;
+            record.microseconds = nanoseconds / 1_000 % 1_000;
+            record.nanoseconds = nanoseconds % 1_000;
+        }
+    }
+
+    if last_unit.is_none() {
+        return Err(syntax_error(
+            "Duration strings must contain at least one unit.",
+        ));
+    }
+
+    Ok(record)
+}
+
+/// Parses the leading ASCII digits of `bytes` as an integer.
+fn parse_integer(bytes: &[u8]) -> TemporalResult<(u64, &[u8])> {
+    let digits = bytes.iter().take_while(|b| b.is_ascii_digit()).count();
+    if digits == 0 {
+        return Err(syntax_error("Expected a digit in duration string."));
+    }
+    let (integer, rest) = bytes.split_at(digits);
+    let value = integer.iter().try_fold(0u64, |value, digit| {
+        value
+            .checked_mul(10)
+            .and_then(|value| value.checked_add(u64::from(digit - b'0')))
+            .filter(|value| *value <= MAX_SAFE_INTEGER)
+    });
+    match value {
+        Some(value) => Ok((value, rest)),
+        None => {
+            Err(TemporalError::range()
+                .with_message("Duration field exceeds the maximum safe integer."))
+        }
+    }
+}
+
+/// Parses an optional fraction of one to nine digits, returning it in billionths.
+fn parse_fraction(bytes: &[u8]) -> TemporalResult<(Option<u64>, &[u8])> {
+    let bytes = match bytes.split_first() {
+        Some((b'.' | b',', rest)) => rest,
+        _ => return Ok((None, bytes)),
+    };
+    let digits = bytes.iter().take_while(|b| b.is_ascii_digit()).count();
+    if !(1..=9).contains(&digits) {
+        return Err(syntax_error(
+            "Duration fractions must have one to nine digits.",
+        ));
+    }
+    let (fraction, rest) = bytes.split_at(digits);
+    let value = fraction
+        .iter()
+        .fold(0u64, |value, digit| value * 10 + u64::from(digit - b'0'));
+    Ok((Some(value * 10u64.pow(9 - digits as u32)), rest))
+}
+
+#[inline]
+fn syntax_error(message: &'static str) -> TemporalError {
+    TemporalError::syntax().with_message(message)
+}
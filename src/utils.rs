@@ -49,18 +49,9 @@ pub(crate) fn epoch_time_for_year(y: i32) -> f64 {
 }
 
 pub(crate) fn epoch_time_to_epoch_year(t: f64) -> i32 {
-    // roughly calculate the largest possible year given the time t,
-    // then check and refine the year.
-    let day_count = epoch_time_to_day_number(t);
-    let mut year = (day_count / 365) + 1970;
-    loop {
-        if epoch_time_for_year(year) <= t {
-            break;
-        }
-        year -= 1;
-    }
-
-    year
+    // NOTE: Refining a rough estimate of the year from `t` does not hold for times long before
+    // the epoch, so the year is taken from the integer civil day equations.
+    gregorian_date_from_epoch_days(i64::from(epoch_time_to_day_number(t))).0
 }
 
 /// Returns either 1 (true) or 0 (false)
@@ -138,6 +129,69 @@ pub(crate) fn epoch_time_to_day_in_year(t: f64) -> i32 {
 
 // EpochTimeTOWeekDay -> REMOVED
 
+// ==== Integer Civil Day Equations ====
+
+/// Returns the number of days since the Unix epoch for a proleptic Gregorian date.
+///
+/// `month` is 1-based. Unlike the `f64` equations above, this is exact over
+/// the entire `i32` year range and does not require balancing.
+#[inline]
+pub(crate) const fn epoch_days_from_gregorian_date(year: i32, month: u8, day: u8) -> i64 {
+    // NOTE: The below shifts the year to begin in March so that the
+    // leap day is always the final day of the shifted year.
+    let year = if month <= 2 {
+        year as i64 - 1
+    } else {
+        year as i64
+    };
+    let era = year.div_euclid(400);
+    let year_of_era = year - era * 400;
+    let shifted_month = (if month > 2 { month - 3 } else { month + 9 }) as i64;
+    let day_of_year = (153 * shifted_month + 2) / 5 + day as i64 - 1;
+    let day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    // 719_468 is the number of days from 0000-03-01 to 1970-01-01.
+    era * 146_097 + day_of_era - 719_468
+}
+
+/// Returns the proleptic Gregorian `(year, month, day)` for a number of days since the Unix
+/// epoch. This is the inverse of `epoch_days_from_gregorian_date`.
+#[inline]
+pub(crate) const fn gregorian_date_from_epoch_days(epoch_days: i64) -> (i32, u8, u8) {
+    let days = epoch_days + 719_468;
+    let era = days.div_euclid(146_097);
+    let day_of_era = days - era * 146_097;
+    let year_of_era =
+        (day_of_era - day_of_era / 1460 + day_of_era / 36_524 - day_of_era / 146_096) / 365;
+    let day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    let shifted_month = (5 * day_of_year + 2) / 153;
+    let day = day_of_year - (153 * shifted_month + 2) / 5 + 1;
+    let month = if shifted_month < 10 {
+        shifted_month + 3
+    } else {
+        shifted_month - 9
+    };
+    let year = year_of_era + era * 400 + if month <= 2 { 1 } else { 0 };
+    (year as i32, month as u8, day as u8)
+}
+
+/// Returns whether the provided year is a leap year in the proleptic Gregorian calendar.
+#[inline]
+pub(crate) const fn is_gregorian_leap_year(year: i32) -> bool {
+    year % 4 == 0 && (year % 100 != 0 || year % 400 == 0)
+}
+
+/// Returns the days in the provided 1-based month of a proleptic Gregorian year.
+#[inline]
+pub(crate) const fn gregorian_days_in_month(year: i32, month: u8) -> u8 {
+    match month {
+        1 | 3 | 5 | 7 | 8 | 10 | 12 => 31,
+        4 | 6 | 9 | 11 => 30,
+        2 if is_gregorian_leap_year(year) => 29,
+        2 => 28,
+        _ => 0,
+    }
+}
+
 // ==== End Date Equations ====
 
 // ==== Begin Calendar Equations ====
@@ -149,7 +203,7 @@ pub(crate) fn iso_days_in_month(year: i32, month: i32) -> i32 {
     match month {
         1 | 3 | 5 | 7 | 8 | 10 | 12 => 31,
         4 | 6 | 9 | 11 => 30,
-        2 => 28 + mathematical_in_leap_year(epoch_time_for_year(year)),
+        2 => 28 + i32::from(is_gregorian_leap_year(year)),
         _ => unreachable!("ISODaysInMonth panicking is an implementation error."),
     }
 }
@@ -316,4 +370,60 @@ mod tests {
             "December is unaligned."
         );
     }
+
+    #[test]
+    fn gregorian_epoch_days() {
+        assert_eq!(epoch_days_from_gregorian_date(1970, 1, 1), 0);
+        assert_eq!(epoch_days_from_gregorian_date(1969, 12, 31), -1);
+        assert_eq!(epoch_days_from_gregorian_date(2000, 3, 1), 11_017);
+        assert_eq!(epoch_days_from_gregorian_date(2020, 2, 29), 18_321);
+        assert_eq!(
+            epoch_days_from_gregorian_date(-271_821, 4, 20),
+            -100_000_000
+        );
+        assert_eq!(epoch_days_from_gregorian_date(275_760, 9, 13), 100_000_000);
+
+        assert_eq!(gregorian_days_in_month(1900, 2), 28);
+        assert_eq!(gregorian_days_in_month(2000, 2), 29);
+        assert_eq!(gregorian_days_in_month(-4, 2), 29);
+        assert_eq!(gregorian_days_in_month(2023, 13), 0);
+
+        for (year, days) in [
+            (-400, 29),
+            (-100, 28),
+            (-1, 28),
+            (0, 29),
+            (461, 28),
+            (464, 29),
+        ] {
+            assert_eq!(
+                iso_days_in_month(year, 2),
+                days,
+                "February {year} is wrong."
+            );
+        }
+
+        // Check the kernel against the `f64` date equations.
+        for year in [-10_000, -401, -1, 0, 1, 1900, 1972, 2023, 2100, 10_000] {
+            for month in 1..=12u8 {
+                let t = epoch_time_for_year(year)
+                    + epoch_time_for_month_given_year(i32::from(month) - 1, year);
+                assert_eq!(
+                    epoch_days_from_gregorian_date(year, month, 1),
+                    i64::from(epoch_time_to_day_number(t)),
+                    "{year}-{month} is unaligned."
+                );
+            }
+        }
+    }
+
+    #[test]
+    fn time_to_epoch_year() {
+        // The estimate of the year used to be too early for any year before 465.
+        for year in [-271_821, -239_043, -1, 0, 464, 465, 1970, 2024, 275_760] {
+            let t = epoch_time_for_year(year);
+            assert_eq!(epoch_time_to_epoch_year(t), year);
+            assert_eq!(epoch_time_to_epoch_year(t - 1.0), year - 1);
+        }
+    }
 }
@@ -0,0 +1,121 @@
+/*
+ * C declarations for the `temporal_rs` C ABI.
+ *
+ * Every entry point returns a `TemporalStatus` and writes its result into a
+ * caller provided output buffer. Batch entry points stop at the first failing
+ * element and return its status; later outputs are left unwritten.
+ */
+
+#ifndef TEMPORAL_RS_H
+#define TEMPORAL_RS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef int32_t TemporalStatus;
+
+#define TEMPORAL_STATUS_OK 0
+#define TEMPORAL_STATUS_GENERIC_ERROR 1
+#define TEMPORAL_STATUS_TYPE_ERROR 2
+#define TEMPORAL_STATUS_RANGE_ERROR 3
+#define TEMPORAL_STATUS_SYNTAX_ERROR 4
+#define TEMPORAL_STATUS_ASSERT_ERROR 5
+#define TEMPORAL_STATUS_NULL_POINTER 6
+
+#define TEMPORAL_OVERFLOW_CONSTRAIN 0
+#define TEMPORAL_OVERFLOW_REJECT 1
+
+#define TEMPORAL_UNIT_DAY 7
+#define TEMPORAL_UNIT_WEEK 8
+#define TEMPORAL_UNIT_MONTH 9
+#define TEMPORAL_UNIT_YEAR 10
+
+typedef struct TemporalIsoDate {
+    int32_t year;
+    uint8_t month;
+    uint8_t day;
+} TemporalIsoDate;
+
+typedef struct TemporalIsoTime {
+    uint8_t hour;
+    uint8_t minute;
+    uint8_t second;
+    uint16_t millisecond;
+    uint16_t microsecond;
+    uint16_t nanosecond;
+} TemporalIsoTime;
+
+typedef struct TemporalIsoDateTime {
+    TemporalIsoDate date;
+    TemporalIsoTime time;
+} TemporalIsoDateTime;
+
+/* Epoch nanoseconds as `((int128_t)epoch_nanoseconds_high << 64) | epoch_nanoseconds_low`. */
+typedef struct TemporalInstant {
+    int64_t epoch_nanoseconds_high;
+    uint64_t epoch_nanoseconds_low;
+} TemporalInstant;
+
+typedef struct TemporalDuration {
+    double years;
+    double months;
+    double weeks;
+    double days;
+    double hours;
+    double minutes;
+    double seconds;
+    double milliseconds;
+    double microseconds;
+    double nanoseconds;
+} TemporalDuration;
+
+/* A borrowed UTF-8 string that does not need to be NUL terminated. */
+typedef struct TemporalUtf8 {
+    const uint8_t *data;
+    size_t len;
+} TemporalUtf8;
+
+TemporalStatus temporal_iso_date_validate(const TemporalIsoDate *date);
+
+TemporalStatus temporal_iso_date_add(const TemporalIsoDate *date,
+                                     const TemporalDuration *duration,
+                                     int32_t overflow,
+                                     TemporalIsoDate *out);
+
+TemporalStatus temporal_iso_date_add_batch(const TemporalIsoDate *dates,
+                                           size_t len,
+                                           const TemporalDuration *duration,
+                                           int32_t overflow,
+                                           TemporalIsoDate *out);
+
+TemporalStatus temporal_iso_date_until(const TemporalIsoDate *one,
+                                       const TemporalIsoDate *two,
+                                       int32_t largest_unit,
+                                       TemporalDuration *out);
+
+TemporalStatus temporal_iso_date_time_to_instant(const TemporalIsoDateTime *date_time,
+                                                 int64_t offset_nanoseconds,
+                                                 TemporalInstant *out);
+
+TemporalStatus temporal_iso_date_time_to_instant_batch(const TemporalIsoDateTime *date_times,
+                                                       size_t len,
+                                                       int64_t offset_nanoseconds,
+                                                       TemporalInstant *out);
+
+TemporalStatus temporal_instant_from_utf8(TemporalUtf8 source, TemporalInstant *out);
+
+TemporalStatus temporal_instant_from_utf8_batch(const TemporalUtf8 *sources,
+                                                size_t len,
+                                                TemporalInstant *out);
+
+TemporalStatus temporal_duration_from_utf8(TemporalUtf8 source, TemporalDuration *out);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* TEMPORAL_RS_H */
@@ -0,0 +1,5 @@
+//! The `temporal_capi` crate builds `temporal_rs`'s C ABI as a static and dynamic library.
+//!
+//! See `include/temporal_rs.h` for the C declarations of the exported entry points.
+
+pub use temporal_rs::capi::*;